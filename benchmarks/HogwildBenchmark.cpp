@@ -0,0 +1,120 @@
+// Hogwild vs synchronous mini-batch SGD on synthetic sparse data.
+// Usage: HogwildBenchmark [rows] [epochs] [batchSize]
+//
+// Rows look like hashed categorical logs: a few dozen active columns out of
+// 2^18, with labels drawn from a hidden sparse logistic model. For every
+// thread count the table reports training throughput (samples / second)
+// and the final mean log-loss on the training rows. Synchronous SGD can
+// only split a batch into blocks of LogisticRegression::SPARSE_ROWS_PER_BLOCK
+// rows, so "sync threads" shows how many threads it really uses; with the
+// default batch of 16 it is the single-threaded baseline.
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include "LogisticRegression.h"
+#include "Parallel.h"
+#include "SparseMatrix.h"
+#include "Vector.h"
+
+namespace {
+
+const int NUM_FEATURES = 1 << 18;
+const int ACTIVE_PER_ROW = 32;
+
+// Sparse rows with labels sampled from a hidden model
+void makeData(int rows, SparseMatrix& X, Vector& y) {
+    std::mt19937_64 rng(7);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_int_distribution<int> column(0, NUM_FEATURES - 1);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+    std::vector<double> truth(NUM_FEATURES);
+    for (double& t : truth) {
+        t = normal(rng);
+    }
+
+    X = SparseMatrix(NUM_FEATURES);
+    X.reserve(rows, static_cast<long long>(rows) * ACTIVE_PER_ROW);
+    y = Vector(rows);
+    std::vector<std::pair<int, double>> row;
+    for (int i = 0; i < rows; i++) {
+        row.clear();
+        double z = 0.0;
+        for (int k = 0; k < ACTIVE_PER_ROW; k++) {
+            int j = column(rng);
+            row.push_back(std::make_pair(j, 1.0));
+            z += truth[j] / std::sqrt(static_cast<double>(ACTIVE_PER_ROW));
+        }
+        X.appendRow(row);
+        y[i] = (uniform(rng) < 1.0 / (1.0 + std::exp(-z))) ? 1.0 : 0.0;
+    }
+}
+
+double meanLogLoss(LogisticRegression& model, const SparseMatrix& X, const Vector& y) {
+    Vector p = model.predictProba(X);
+    double loss = 0.0;
+    for (int i = 0; i < y.getSize(); i++) {
+        double q = std::min(1 - 1e-7, std::max(1e-7, p[i]));
+        loss -= y[i] * std::log(q) + (1 - y[i]) * std::log(1 - q);
+    }
+    return loss / y.getSize();
+}
+
+// Train quietly and return (samples / second, final loss)
+std::pair<double, double> run(const SparseMatrix& X, const Vector& y, bool hogwild,
+                              int epochs, int batchSize) {
+    LogisticRegression model(0.5, epochs);
+    model.setBatchSize(batchSize);
+    model.setAsynchronous(hogwild);
+
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+    auto start = std::chrono::steady_clock::now();
+    model.train(X, y);
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout.rdbuf(saved);
+
+    double throughput = static_cast<double>(X.getRows()) * epochs / seconds;
+    return std::make_pair(throughput, meanLogLoss(model, X, y));
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    int rows = (argc > 1) ? std::atoi(argv[1]) : 200000;
+    int epochs = (argc > 2) ? std::atoi(argv[2]) : 3;
+    int batchSize = (argc > 3) ? std::atoi(argv[3]) : 16;
+
+    SparseMatrix X;
+    Vector y;
+    makeData(rows, X, y);
+
+    std::cout << "Hogwild benchmark: " << rows << " rows, " << NUM_FEATURES << " features, "
+              << ACTIVE_PER_ROW << " non-zeros/row, " << epochs << " epochs, batch " << batchSize
+              << " (hardware threads: " << Parallel::getThreadCount() << ")" << std::endl;
+    std::cout << std::setw(8) << "threads" << std::setw(14) << "sync threads"
+              << std::setw(18) << "sync samples/s" << std::setw(12) << "sync loss"
+              << std::setw(18) << "hogwild samples/s" << std::setw(14) << "hogwild loss" << std::endl;
+
+    for (int threads : {1, 2, 4, 8, 16, 32}) {
+        Parallel::setThreadCount(threads);
+        std::pair<double, double> sync = run(X, y, false, epochs, batchSize);
+        std::pair<double, double> hogwild = run(X, y, true, epochs, batchSize);
+        int syncThreads = Parallel::blockCount(batchSize, LogisticRegression::SPARSE_ROWS_PER_BLOCK);
+        std::cout << std::setw(8) << threads << std::setw(14) << syncThreads << std::fixed
+                  << std::setw(18) << std::setprecision(0) << sync.first
+                  << std::setw(12) << std::setprecision(4) << sync.second
+                  << std::setw(18) << std::setprecision(0) << hogwild.first
+                  << std::setw(14) << std::setprecision(4) << hogwild.second << std::endl;
+    }
+    Parallel::setThreadCount(0);
+    return 0;
+}
@@ -0,0 +1,138 @@
+// Hourly model refresh: retraining on all history vs partialFit on the new batch.
+// Usage: IncrementalBenchmark [rowsPerHour] [hours] [features]
+//
+// Every simulated hour a new batch arrives from a slowly drifting linear
+// model. The retrain strategy runs mini-batch SGD from zero over every row
+// seen so far; the incremental strategy calls partialFit on the new batch
+// only. The table reports the refresh time of each and their accuracy
+// (Evaluation) and log-loss on a held-out batch from the same hour.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "DataView.h"
+#include "Evaluation.h"
+#include "LogisticRegression.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+namespace {
+
+// Rows [first, first + rows) of X/y from the hour's true weights
+void makeBatch(const std::vector<double>& truth, int rows, std::mt19937_64& rng,
+               Matrix& X, Vector& y, int first) {
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    int features = static_cast<int>(truth.size());
+    for (int i = first; i < first + rows; i++) {
+        double* x = X.rowData(i);
+        double z = 0.2;
+        for (int j = 0; j < features; j++) {
+            x[j] = normal(rng);
+            z += truth[j] * x[j];
+        }
+        y[i] = (uniform(rng) < 1.0 / (1.0 + std::exp(-z))) ? 1.0 : 0.0;
+    }
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double logLoss(const Vector& p, const Vector& y) {
+    double sum = 0.0;
+    for (int i = 0; i < p.getSize(); i++) {
+        double q = std::min(std::max(p[i], 1e-7), 1 - 1e-7);
+        sum -= y[i] * std::log(q) + (1 - y[i]) * std::log(1 - q);
+    }
+    return sum / p.getSize();
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    int rowsPerHour = (argc > 1) ? std::atoi(argv[1]) : 20000;
+    int hours = (argc > 2) ? std::atoi(argv[2]) : 24;
+    int features = (argc > 3) ? std::atoi(argv[3]) : 32;
+    const int retrainEpochs = 3;
+
+    std::mt19937_64 rng(21);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::vector<double> truth(features);
+    for (double& w : truth) {
+        w = normal(rng) / std::sqrt(static_cast<double>(features)) * 2.0;
+    }
+
+    Matrix history(rowsPerHour * hours, features);
+    Vector labels(rowsPerHour * hours);
+    Matrix holdout(rowsPerHour, features);
+    Vector holdoutLabels(rowsPerHour);
+
+    LogisticRegression incremental(0.05, 1);
+    incremental.setBatchSize(256);
+
+    std::cout << "Incremental benchmark: " << hours << " hours x " << rowsPerHour << " rows, "
+              << features << " features (retrain: " << retrainEpochs << " SGD epochs on all history)"
+              << std::endl;
+    std::cout << std::setw(6) << "hour" << std::setw(12) << "history"
+              << std::setw(14) << "retrain ms" << std::setw(14) << "partial ms"
+              << std::setw(12) << "acc full" << std::setw(12) << "acc part"
+              << std::setw(12) << "loss full" << std::setw(12) << "loss part" << std::endl;
+
+    double retrainTotal = 0.0;
+    double partialTotal = 0.0;
+    std::ostringstream sink;
+    for (int hour = 0; hour < hours; hour++) {
+        // Slow drift of the true model
+        for (double& w : truth) {
+            w += 0.02 * normal(rng);
+        }
+        int first = hour * rowsPerHour;
+        makeBatch(truth, rowsPerHour, rng, history, labels, first);
+        makeBatch(truth, rowsPerHour, rng, holdout, holdoutLabels, 0);
+
+        std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+        std::vector<int> seen(first + rowsPerHour);
+        for (size_t i = 0; i < seen.size(); i++) {
+            seen[i] = static_cast<int>(i);
+        }
+        auto start = std::chrono::steady_clock::now();
+        LogisticRegression full(0.05, retrainEpochs);
+        full.setBatchSize(256);
+        full.train(DataView(history, labels, seen));
+        double retrainSeconds = secondsSince(start);
+
+        std::vector<int> fresh(seen.begin() + first, seen.end());
+        start = std::chrono::steady_clock::now();
+        incremental.partialFit(DataView(history, labels, fresh));
+        double partialSeconds = secondsSince(start);
+        std::cout.rdbuf(saved);
+        sink.str("");
+
+        retrainTotal += retrainSeconds;
+        partialTotal += partialSeconds;
+
+        if (hour == 0 || (hour + 1) % 6 == 0 || hour + 1 == hours) {
+            Vector fullProba = full.predictProba(holdout);
+            Vector partProba = incremental.predictProba(holdout);
+            std::cout << std::fixed << std::setw(6) << (hour + 1) << std::setw(12) << (first + rowsPerHour)
+                      << std::setprecision(1) << std::setw(14) << retrainSeconds * 1000.0
+                      << std::setw(14) << partialSeconds * 1000.0 << std::setprecision(4)
+                      << std::setw(12) << Evaluation::calculateAccuracy(full.predict(holdout), holdoutLabels)
+                      << std::setw(12) << Evaluation::calculateAccuracy(incremental.predict(holdout), holdoutLabels)
+                      << std::setw(12) << logLoss(fullProba, holdoutLabels)
+                      << std::setw(12) << logLoss(partProba, holdoutLabels) << std::endl;
+        }
+    }
+    std::cout << std::fixed << std::setprecision(1) << "Total refresh time: retrain " << retrainTotal * 1000.0
+              << " ms, partialFit " << partialTotal * 1000.0 << " ms ("
+              << incremental.getPartialFitRows() << " rows absorbed)" << std::endl;
+    return 0;
+}
@@ -0,0 +1,167 @@
+// Batch scoring with double weights vs the int8 QuantizedLogisticRegression.
+// Usage: QuantizedBenchmark [rows] [features]
+//
+// A model trained on a synthetic dense problem is quantized with the
+// first 10,000 rows as the calibration sample. The table reports rows per
+// second and bytes read per row for double scoring, int8 scoring of a
+// pre-quantized batch, and int8 scoring with on-the-fly quantization, plus
+// the largest probability difference from the double model. Accuracy
+// deltas against the true labels come from Evaluation.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DataView.h"
+#include "Evaluation.h"
+#include "LogisticRegression.h"
+#include "Matrix.h"
+#include "Parallel.h"
+#include "QuantizedLogisticRegression.h"
+#include "Vector.h"
+
+namespace {
+
+// Features with mixed scales and offsets; labels drawn from a noisy linear model
+void makeData(int rows, int features, Matrix& X, Vector& y) {
+    std::mt19937_64 rng(13);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    X = Matrix(rows, features);
+    y = Vector(rows);
+    for (int i = 0; i < rows; i++) {
+        double* x = X.rowData(i);
+        double z = 0.0;
+        for (int j = 0; j < features; j++) {
+            double scale = 1.0 + (j % 5);
+            double raw = normal(rng);
+            x[j] = (j % 3) + scale * raw;
+            z += raw * ((j % 2 == 0) ? 1.0 : -0.7) / std::sqrt(static_cast<double>(features));
+        }
+        y[i] = (uniform(rng) < 1.0 / (1.0 + std::exp(-4.0 * z))) ? 1.0 : 0.0;
+    }
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+double maxDifference(const Vector& a, const Vector& b) {
+    double worst = 0.0;
+    for (int i = 0; i < a.getSize(); i++) {
+        worst = std::max(worst, std::fabs(a[i] - b[i]));
+    }
+    return worst;
+}
+
+Vector threshold(const Vector& probabilities) {
+    Vector labels(probabilities.getSize());
+    for (int i = 0; i < probabilities.getSize(); i++) {
+        labels[i] = (probabilities[i] >= 0.5) ? 1.0 : 0.0;
+    }
+    return labels;
+}
+
+void report(const std::string& name, int rows, int bytesPerRow, double seconds, double difference) {
+    std::cout << std::setw(26) << std::left << name << std::right << std::fixed
+              << std::setw(14) << std::setprecision(0) << rows / seconds
+              << std::setw(10) << std::setprecision(1) << seconds * 1000.0
+              << std::setw(10) << bytesPerRow
+              << std::setw(14) << std::scientific << std::setprecision(2) << difference
+              << std::endl;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    int rows = (argc > 1) ? std::atoi(argv[1]) : 1000000;
+    int features = (argc > 2) ? std::atoi(argv[2]) : 64;
+    const int repeats = 5;
+
+    Matrix X;
+    Vector y;
+    makeData(rows, features, X, y);
+    DataView all(X, y);
+
+    // Quiet mini-batch training on the first rows
+    std::vector<int> head(std::min(rows, 200000));
+    for (size_t i = 0; i < head.size(); i++) {
+        head[i] = static_cast<int>(i);
+    }
+    LogisticRegression model(0.05, 5);
+    model.setBatchSize(256);
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+    model.train(DataView(X, y, head));
+    std::cout.rdbuf(saved);
+
+    std::vector<int> sample(head.begin(), head.begin() + std::min<size_t>(head.size(), 10000));
+    auto start = std::chrono::steady_clock::now();
+    QuantizedLogisticRegression quantized(model, DataView(X, y, sample));
+    double calibrationMs = secondsSince(start) * 1000.0;
+
+    start = std::chrono::steady_clock::now();
+    QuantizedRows codes = quantized.quantize(all);
+    double quantizeMs = secondsSince(start) * 1000.0;
+
+    std::cout << "Quantized scoring benchmark: " << rows << " rows, " << features << " features"
+              << " (threads: " << Parallel::getThreadCount() << ")" << std::endl;
+    std::cout << "Calibration: " << std::fixed << std::setprecision(2) << calibrationMs
+              << " ms; quantizing the batch once: " << quantizeMs << " ms" << std::endl;
+    std::cout << std::setw(26) << std::left << "method" << std::right
+              << std::setw(14) << "rows/s" << std::setw(10) << "ms"
+              << std::setw(10) << "B/row" << std::setw(14) << "max |diff|" << std::endl;
+
+    // Best of several passes for each method
+    Vector exact;
+    double best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        start = std::chrono::steady_clock::now();
+        exact = model.predictProba(all);
+        best = std::min(best, secondsSince(start));
+    }
+    report("double predictProba", rows, features * static_cast<int>(sizeof(double)), best, 0.0);
+
+    Vector fromCodes;
+    best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        start = std::chrono::steady_clock::now();
+        fromCodes = quantized.predictProba(codes);
+        best = std::min(best, secondsSince(start));
+    }
+    report("int8 (pre-quantized)", rows, codes.stride, best, maxDifference(exact, fromCodes));
+
+    Vector onTheFly;
+    best = 1e30;
+    for (int r = 0; r < repeats; r++) {
+        start = std::chrono::steady_clock::now();
+        onTheFly = quantized.predictProba(all);
+        best = std::min(best, secondsSince(start));
+    }
+    report("int8 (quantize per row)", rows, features * static_cast<int>(sizeof(double)), best,
+           maxDifference(exact, onTheFly));
+
+    // Accuracy against the true labels; rows past the training head are held out
+    Vector labels = all.gatherLabels();
+    Vector exactLabels = threshold(exact);
+    Vector quantizedLabels = threshold(fromCodes);
+    double exactAccuracy = Evaluation::calculateAccuracy(exactLabels, labels);
+    double quantizedAccuracy = Evaluation::calculateAccuracy(quantizedLabels, labels);
+    std::cout << std::fixed << std::setprecision(4)
+              << "Accuracy: double " << exactAccuracy * 100 << "%, int8 " << quantizedAccuracy * 100
+              << "% (delta " << std::showpos << (quantizedAccuracy - exactAccuracy) * 100 << std::noshowpos
+              << " points); F1 delta " << std::showpos
+              << (Evaluation::calculateF1Score(quantizedLabels, labels) -
+                  Evaluation::calculateF1Score(exactLabels, labels)) * 100
+              << std::noshowpos << " points" << std::endl;
+    std::cout << "Labels that flip under quantization: "
+              << (1.0 - Evaluation::calculateAccuracy(quantizedLabels, exactLabels)) * 100 << "%" << std::endl;
+    return 0;
+}
@@ -0,0 +1,95 @@
+// Hyperparameter search: every configuration to the end vs successive halving.
+// Usage: SearchBenchmark [rows] [features] [configs] [workers]
+//
+// A random sample of learning rates, epoch counts and batch sizes is
+// searched twice on one synthetic dataset shared by all trials: once with a
+// single rung (a plain search that trains every configuration fully) and
+// once with successive halving. The table reports wall time, training
+// epochs spent and the winner with its validation accuracy (Evaluation).
+
+#include <cmath>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "DataView.h"
+#include "HyperparameterSearch.h"
+#include "Matrix.h"
+#include "Vector.h"
+
+namespace {
+
+// Standard normal features and labels from a noisy linear model
+void makeData(int rows, int features, Matrix& X, Vector& y) {
+    std::mt19937_64 rng(17);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    X = Matrix(rows, features);
+    y = Vector(rows);
+    for (int i = 0; i < rows; i++) {
+        double* x = X.rowData(i);
+        double z = -0.3;
+        for (int j = 0; j < features; j++) {
+            x[j] = normal(rng);
+            z += x[j] * ((j % 3 == 0) ? 0.8 : -0.3);
+        }
+        y[i] = (uniform(rng) < 1.0 / (1.0 + std::exp(-z))) ? 1.0 : 0.0;
+    }
+}
+
+void report(const std::string& name, const SearchResult& result) {
+    const TrialResult& best = result.best();
+    std::ostringstream winner;
+    winner << "lr " << std::setprecision(3) << best.config.learningRate << ", " << best.config.epochs
+           << " epochs, batch " << best.config.batchSize;
+    std::cout << std::setw(20) << std::left << name << std::right << std::fixed
+              << std::setw(10) << std::setprecision(2) << result.seconds
+              << std::setw(12) << result.epochsUsed
+              << std::setw(12) << std::setprecision(4) << best.score
+              << "   " << winner.str() << std::endl;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    int rows = (argc > 1) ? std::atoi(argv[1]) : 20000;
+    int features = (argc > 2) ? std::atoi(argv[2]) : 32;
+    int count = (argc > 3) ? std::atoi(argv[3]) : 27;
+    int workers = (argc > 4) ? std::atoi(argv[4]) : 0;
+
+    Matrix X;
+    Vector y;
+    makeData(rows, features, X, y);
+    std::vector<int> trainRows;
+    std::vector<int> validationRows;
+    for (int i = 0; i < rows; i++) {
+        (i % 5 == 0 ? validationRows : trainRows).push_back(i);
+    }
+    DataView train(X, y, trainRows);
+    DataView validation(X, y, validationRows);
+
+    std::vector<HyperparameterConfig> configs =
+        HyperparameterSearch::random(count, 0.001, 1.0, 5, 60, {0, 64, 256}, 3);
+
+    // Search progress is printed by run(); keep only the table
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+    HyperparameterSearch plain(workers, 3, 1);
+    SearchResult full = plain.run(configs, train, validation);
+    HyperparameterSearch halving(workers, 3, 3);
+    SearchResult halved = halving.run(configs, train, validation);
+    std::cout.rdbuf(saved);
+
+    std::cout << "Search benchmark: " << count << " configurations, " << trainRows.size() << " training / "
+              << validationRows.size() << " validation rows, " << features << " features, "
+              << plain.getWorkers() << " workers" << std::endl;
+    std::cout << std::setw(20) << std::left << "strategy" << std::right << std::setw(10) << "seconds"
+              << std::setw(12) << "epochs" << std::setw(12) << "accuracy" << "   best configuration" << std::endl;
+    report("every config, full", full);
+    report("successive halving", halved);
+    return 0;
+}
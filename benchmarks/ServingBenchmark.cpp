@@ -0,0 +1,134 @@
+// Micro-batching scoring server over a Unix domain socket, all in one process.
+// Usage: ServingBenchmark [clients] [requestsPerClient] [features]
+//
+// A server thread serves a fixed model on a temporary socket while client
+// threads each send requests one at a time and wait for every reply
+// (closed loop). For each batching configuration the table reports the
+// server's latency percentiles, throughput and mean batch size; batch 1 /
+// wait 0 is the unbatched baseline.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include "LogisticRegression.h"
+#include "ScoringServer.h"
+
+namespace {
+
+// Connect to the server, retrying while it is still starting up
+int connectTo(const std::string& path) {
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+    for (int attempt = 0; attempt < 200; attempt++) {
+        int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (::connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0) {
+            return fd;
+        }
+        ::close(fd);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return -1;
+}
+
+// Closed loop: send one row, read one reply line, repeat
+void runClient(const std::string& path, int requests, int features, unsigned seed) {
+    int fd = connectTo(path);
+    if (fd < 0) {
+        std::cerr << "Client could not connect" << std::endl;
+        return;
+    }
+    std::mt19937 rng(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    char reply[64];
+    for (int r = 0; r < requests; r++) {
+        std::ostringstream line;
+        for (int j = 0; j < features; j++) {
+            line << (j > 0 ? "," : "") << normal(rng);
+        }
+        line << "\n";
+        std::string message = line.str();
+        if (::send(fd, message.data(), message.size(), 0) < 0) {
+            break;
+        }
+        // Replies are short; read until the newline
+        size_t received = 0;
+        while (received == 0 || reply[received - 1] != '\n') {
+            ssize_t n = ::recv(fd, reply + received, sizeof(reply) - received, 0);
+            if (n <= 0) {
+                ::close(fd);
+                return;
+            }
+            received += static_cast<size_t>(n);
+        }
+    }
+    ::close(fd);
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    int clients = (argc > 1) ? std::atoi(argv[1]) : 16;
+    int requestsPerClient = (argc > 2) ? std::atoi(argv[2]) : 2000;
+    int features = (argc > 3) ? std::atoi(argv[3]) : 32;
+
+    // Fixed random model
+    std::mt19937 rng(5);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    SparseWeights weights;
+    weights.numFeatures = features;
+    for (int j = 0; j < features; j++) {
+        weights.indices.push_back(j);
+        weights.values.push_back(normal(rng) / features);
+    }
+    LogisticRegression model;
+    model.setSparseWeights(weights);
+
+    std::string path = "/tmp/titanlearn_serving_" + std::to_string(::getpid()) + ".sock";
+    std::cout << "Serving benchmark: " << clients << " clients x " << requestsPerClient
+              << " requests, " << features << " features, socket " << path << std::endl;
+    std::cout << std::setw(8) << "batch" << std::setw(10) << "wait us"
+              << std::setw(12) << "p50 us" << std::setw(12) << "p99 us"
+              << std::setw(14) << "requests/s" << std::setw(12) << "mean batch" << std::endl;
+
+    struct Config { int batch; int waitMicros; };
+    for (Config config : {Config{1, 0}, Config{16, 100}, Config{64, 200}, Config{256, 500}}) {
+        ServingOptions options;
+        options.maxBatchSize = config.batch;
+        options.maxWaitMicros = config.waitMicros;
+        ScoringServer server(model, options);
+
+        ServingStats stats;
+        std::thread serverThread([&]() { stats = server.serveSocket(path); });
+        std::vector<std::thread> clientThreads;
+        for (int c = 0; c < clients; c++) {
+            clientThreads.emplace_back(runClient, path, requestsPerClient, features, 100u + c);
+        }
+        for (std::thread& t : clientThreads) {
+            t.join();
+        }
+        server.stop();
+        serverThread.join();
+
+        std::cout << std::fixed << std::setw(8) << config.batch << std::setw(10) << config.waitMicros
+                  << std::setw(12) << std::setprecision(1) << stats.p50Micros
+                  << std::setw(12) << stats.p99Micros
+                  << std::setw(14) << std::setprecision(0) << stats.throughput
+                  << std::setw(12) << std::setprecision(1) << stats.meanBatchSize << std::endl;
+    }
+    return 0;
+}
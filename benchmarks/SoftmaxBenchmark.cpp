@@ -0,0 +1,134 @@
+// One softmax model vs one-vs-rest binary logistic regressions.
+// Usage: SoftmaxBenchmark [rows] [features] [classes] [epochs]
+//
+// Rows are Gaussian clusters around one random centroid per class. Both
+// approaches run mini-batch SGD with the same batch size and epochs; the
+// one-vs-rest baseline trains one LogisticRegression per class and
+// predicts the class with the highest probability. The table reports
+// training time, scoring time and test accuracy / macro F1.
+
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <vector>
+
+#include "DataView.h"
+#include "Evaluation.h"
+#include "LogisticRegression.h"
+#include "Matrix.h"
+#include "Parallel.h"
+#include "SoftmaxRegression.h"
+#include "Vector.h"
+
+namespace {
+
+const int BATCH_SIZE = 256;
+const double LEARNING_RATE = 0.1;
+
+// Class centroids with unit-variance noise
+void makeData(int rows, int features, int classes, unsigned long seed, Matrix& X, Vector& y) {
+    std::mt19937_64 centroidRng(3);
+    std::mt19937_64 rng(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_int_distribution<int> pick(0, classes - 1);
+
+    Matrix centroids(classes, features);
+    for (int c = 0; c < classes; c++) {
+        for (int j = 0; j < features; j++) {
+            centroids.rowData(c)[j] = 0.4 * normal(centroidRng);
+        }
+    }
+    X = Matrix(rows, features);
+    y = Vector(rows);
+    for (int i = 0; i < rows; i++) {
+        int c = pick(rng);
+        for (int j = 0; j < features; j++) {
+            X.rowData(i)[j] = centroids.rowData(c)[j] + normal(rng);
+        }
+        y[i] = c;
+    }
+}
+
+double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void report(const char* name, double trainSeconds, double scoreSeconds,
+            const Vector& predictions, const Vector& actual, int classes) {
+    std::cout << std::setw(20) << std::left << name << std::right << std::fixed
+              << std::setw(12) << std::setprecision(2) << trainSeconds
+              << std::setw(12) << std::setprecision(3) << scoreSeconds
+              << std::setw(12) << std::setprecision(4) << Evaluation::calculateAccuracy(predictions, actual)
+              << std::setw(12) << Evaluation::calculateMacroF1(predictions, actual, classes) << std::endl;
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    int rows = (argc > 1) ? std::atoi(argv[1]) : 100000;
+    int features = (argc > 2) ? std::atoi(argv[2]) : 32;
+    int classes = (argc > 3) ? std::atoi(argv[3]) : 50;
+    int epochs = (argc > 4) ? std::atoi(argv[4]) : 5;
+
+    Matrix X, XTest;
+    Vector y, yTest;
+    makeData(rows, features, classes, 1, X, y);
+    makeData(rows / 4, features, classes, 2, XTest, yTest);
+    DataView train(X, y);
+    DataView test(XTest, yTest);
+
+    std::cout << "Softmax benchmark: " << rows << " rows, " << features << " features, "
+              << classes << " classes, " << epochs << " epochs, batch " << BATCH_SIZE
+              << " (threads: " << Parallel::getThreadCount() << ")" << std::endl;
+    std::cout << std::setw(20) << std::left << "method" << std::right
+              << std::setw(12) << "train s" << std::setw(12) << "score s"
+              << std::setw(12) << "accuracy" << std::setw(12) << "macro F1" << std::endl;
+
+    std::ostringstream sink;
+    std::streambuf* saved = std::cout.rdbuf(sink.rdbuf());
+
+    // One multinomial model
+    SoftmaxRegression softmax(classes, LEARNING_RATE, epochs);
+    softmax.setBatchSize(BATCH_SIZE);
+    auto start = std::chrono::steady_clock::now();
+    softmax.train(train);
+    double softmaxTrain = secondsSince(start);
+    start = std::chrono::steady_clock::now();
+    Vector softmaxPredictions = softmax.predict(test);
+    double softmaxScore = secondsSince(start);
+
+    // One binary model per class on relabelled copies of y
+    std::vector<LogisticRegression> binary(classes, LogisticRegression(LEARNING_RATE, epochs));
+    Vector yBinary(rows);
+    start = std::chrono::steady_clock::now();
+    for (int c = 0; c < classes; c++) {
+        for (int i = 0; i < rows; i++) {
+            yBinary[i] = (y[i] == c) ? 1.0 : 0.0;
+        }
+        binary[c].setBatchSize(BATCH_SIZE);
+        binary[c].train(DataView(X, yBinary));
+    }
+    double binaryTrain = secondsSince(start);
+    start = std::chrono::steady_clock::now();
+    Vector best(test.getRows(), -1.0);
+    Vector binaryPredictions(test.getRows(), 0.0);
+    for (int c = 0; c < classes; c++) {
+        Vector p = binary[c].predictProba(test);
+        for (int i = 0; i < test.getRows(); i++) {
+            if (p[i] > best[i]) {
+                best[i] = p[i];
+                binaryPredictions[i] = c;
+            }
+        }
+    }
+    double binaryScore = secondsSince(start);
+
+    std::cout.rdbuf(saved);
+    report("softmax", softmaxTrain, softmaxScore, softmaxPredictions, yTest, classes);
+    report("one-vs-rest binary", binaryTrain, binaryScore, binaryPredictions, yTest, classes);
+    std::cout << "Training speedup: " << std::setprecision(1) << (binaryTrain / softmaxTrain) << "x" << std::endl;
+    return 0;
+}
@@ -2,6 +2,7 @@
 #define MATRIX_H
 
 #include "Tensor.h"
+#include "Vector.h"
 #include <iostream>
 
 /**
@@ -20,6 +21,7 @@ public:
     Matrix();
     Matrix(int rows, int cols);
     Matrix(const Matrix& other);
+    Matrix(Matrix&& other) noexcept;
     
     // Destructor
     ~Matrix();
@@ -29,6 +31,7 @@ public:
     Matrix operator-(const Matrix& other) const;     // Matrix subtraction
     Matrix operator*(const Matrix& other) const;     // Matrix multiplication (dot product)
     Matrix& operator=(const Matrix& other);          // Assignment operator
+    Matrix& operator=(Matrix&& other) noexcept;      // Move assignment
     
     // Friend function for stream insertion
     friend std::ostream& operator<<(std::ostream& os, const Matrix& matrix);
@@ -38,6 +41,10 @@ public:
     double& at(int row, int col);                    // Element access with bounds checking
     const double& at(int row, int col) const;        // Const version for read-only access
     
+    // Solve A x = b for symmetric positive definite A by Cholesky (A = L L^T);
+    // returns false if A is not positive definite
+    bool solveCholesky(const Vector& b, Vector& x) const;
+    
     // Override display method
     void display() const override;
 };
@@ -0,0 +1,53 @@
+#ifndef PARALLEL_H
+#define PARALLEL_H
+
+#include <atomic>
+#include <functional>
+
+/**
+ * @class Parallel
+ * @brief Minimal fork-join helper for splitting row ranges across threads
+ *
+ * This class demonstrates:
+ * - Static utility methods with shared configuration
+ * - std::function callbacks for the per-range work
+ * - A persistent worker pool behind a fork-join interface
+ *
+ * forRange() cuts [begin, end) into at most getThreadCount() contiguous
+ * blocks of at least minGrain items and returns when all blocks are done.
+ * The calling thread works on the blocks too; the others are taken by a
+ * pool of worker threads that is started on first use and kept for the
+ * life of the process, so a call costs a queue push and a wake-up rather
+ * than thread creation. Small ranges run inline with no threads at all.
+ * Calls may be nested or made from several threads at once: a caller can
+ * always finish its own blocks, so a busy pool only means less help.
+ *
+ * maxThreads caps the blocks of a single call (0 = getThreadCount()), so a
+ * caller can limit its own share of the cores without changing the
+ * process-wide setting.
+ */
+class Parallel {
+private:
+    static std::atomic<int> threadCount;  // 0 = use std::thread::hardware_concurrency()
+
+public:
+    // Default minGrain shared by the row loops: enough work per block that
+    // handing it to another thread pays off
+    static const int ROWS_PER_BLOCK = 8192;
+
+    // Thread count used by forRange (at least 1)
+    static int getThreadCount();
+    static void setThreadCount(int count);  // 0 restores the hardware default
+
+    // Run body(block, blockBegin, blockEnd) over disjoint blocks covering
+    // [begin, end); the block number lets callers keep per-block state.
+    // body must not throw (it may run on a worker thread)
+    static void forRange(int begin, int end, int minGrain,
+                         const std::function<void(int block, int blockBegin, int blockEnd)>& body,
+                         int maxThreads = 0);
+
+    // Number of blocks forRange will use for a range of this size
+    static int blockCount(int size, int minGrain, int maxThreads = 0);
+};
+
+#endif // PARALLEL_H
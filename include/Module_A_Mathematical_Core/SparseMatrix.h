@@ -0,0 +1,58 @@
+#ifndef SPARSEMATRIX_H
+#define SPARSEMATRIX_H
+
+#include <utility>
+#include <vector>
+
+/**
+ * @class SparseMatrix
+ * @brief Row-major sparse matrix in compressed sparse row (CSR) form
+ *
+ * This class demonstrates:
+ * - A storage layout chosen for the access pattern: rows are appended
+ *   once and then scanned in order, which is exactly what CSR is good at
+ * - Encapsulation of the three CSR arrays behind row accessors
+ *
+ * Row i owns entries [rowStart(i), rowEnd(i)) of getIndices()/getValues().
+ * Column indices inside a row are strictly increasing and values are non-zero.
+ * Memory is proportional to the number of stored entries, not to
+ * rows * columns, so very wide (e.g. hashed) feature spaces are cheap.
+ */
+class SparseMatrix {
+private:
+    int cols;                        // Logical width
+    std::vector<long long> rowPtr;   // rows + 1 offsets into indices/values
+    std::vector<int> indices;        // Column of each stored entry
+    std::vector<double> values;      // Value of each stored entry
+
+public:
+    // Constructors
+    SparseMatrix();
+    explicit SparseMatrix(int numCols);
+
+    // Destructor
+    ~SparseMatrix();
+
+    // Append a row given as (column, value) pairs in any order; duplicate
+    // columns are summed and zeros dropped. The pairs are sorted in place.
+    // Throws std::out_of_range, leaving the matrix unchanged, if a column
+    // is outside [0, getCols())
+    void appendRow(std::vector<std::pair<int, double>>& entries);
+    void reserve(int rows, long long nonZeros);
+    void clear();
+
+    // Row access
+    long long rowStart(int row) const;
+    long long rowEnd(int row) const;
+    double dotRow(int row, const double* dense) const;  // Row . dense vector
+
+    // Getters
+    int getRows() const;
+    int getCols() const;
+    long long getNonZeros() const;
+    const int* getIndices() const;
+    const double* getValues() const;
+    double getValue(int row, int col) const;  // Binary search within the row
+};
+
+#endif // SPARSEMATRIX_H
@@ -9,13 +9,17 @@
  * 
  * This class demonstrates:
  * - Dynamic memory management with proper allocation/deallocation
+ * - Contiguous row-major storage: the row pointers index into one block,
+ *   so whole matrices and vectors can be processed by flat loops
  * - Deep copy semantics (copy constructor and assignment operator)
+ * - Move semantics (ownership transfer without copying the buffer)
  * - Encapsulation with private data members and public interface
  * - Foundation for inheritance hierarchy (Matrix and Vector derive from this)
  */
 class Tensor {
 protected:
-    double** data;  // 2D dynamic array
+    double** data;    // Row pointers into storage (data[i][j])
+    double* storage;  // Contiguous row-major buffer of rows * cols values
     int rows;       // Number of rows
     int cols;       // Number of columns
     
@@ -29,18 +33,28 @@ public:
     Tensor();                                    // Default constructor
     Tensor(int rows, int cols);                  // Parameterized constructor
     Tensor(const Tensor& other);                 // Copy constructor (deep copy)
+    Tensor(Tensor&& other) noexcept;             // Move constructor (steals the buffer)
     
     // Destructor
     virtual ~Tensor();                           // Virtual destructor for proper cleanup in inheritance
     
     // Assignment operator
     Tensor& operator=(const Tensor& other);      // Deep copy assignment
+    Tensor& operator=(Tensor&& other) noexcept;  // Move assignment
     
     // Getters
     int getRows() const;
     int getCols() const;
     double getValue(int row, int col) const;
     
+    // Raw row access (unchecked) for bulk copy and numeric kernels
+    double* rowData(int row);
+    const double* rowData(int row) const;
+    
+    // Whole contiguous buffer (rows * cols values, row-major)
+    double* rawData();
+    const double* rawData() const;
+    
     // Setters
     void setValue(int row, int col, double value);
     
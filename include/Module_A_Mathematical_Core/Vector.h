@@ -24,12 +24,14 @@ public:
     Vector(int size);                                // Size-only constructor
     Vector(int size, double defaultValue);           // Constructor with default value
     Vector(const Vector& other);                     // Copy constructor
+    Vector(Vector&& other) noexcept;                 // Move constructor
     
     // Destructor
     ~Vector();
     
     // Assignment operator
     Vector& operator=(const Vector& other);
+    Vector& operator=(Vector&& other) noexcept;
     
     // Vector-specific methods
     int getSize() const;
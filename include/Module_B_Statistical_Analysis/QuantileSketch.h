@@ -0,0 +1,46 @@
+#ifndef QUANTILESKETCH_H
+#define QUANTILESKETCH_H
+
+/**
+ * @class QuantileSketch
+ * @brief Constant-memory streaming estimate of a single quantile
+ *
+ * This class demonstrates:
+ * - The P-square algorithm (Jain & Chlamtac, 1985): five markers whose
+ *   heights are nudged by piecewise-parabolic interpolation as values arrive
+ * - Fixed-size state: memory does not grow with the number of observations
+ *
+ * The first five values are kept exactly, so tiny streams report the exact
+ * (linearly interpolated) quantile; after that the middle marker is the
+ * estimate. Values must be added one at a time and sketches cannot be merged,
+ * so callers parallelize across independent sketches, not across one stream.
+ */
+class QuantileSketch {
+private:
+    double p;                 // Target quantile in [0, 1]
+    long long count;          // Observations seen
+    double heights[5];        // Marker heights (first five raw values until count >= 5)
+    double positions[5];      // Actual marker positions (1-based)
+    double desired[5];        // Desired marker positions
+    double increments[5];     // Desired position increments per observation
+
+    double parabolic(int i, double d) const;
+    double linear(int i, int d) const;
+
+public:
+    // Constructor
+    explicit QuantileSketch(double quantile = 0.5);
+
+    // Feed one observation
+    void add(double x);
+
+    // Forget everything seen so far (keeps the target quantile)
+    void reset();
+
+    // Getters
+    double getEstimate() const;   // 0 when nothing has been added
+    double getQuantile() const;
+    long long getCount() const;
+};
+
+#endif // QUANTILESKETCH_H
@@ -0,0 +1,59 @@
+#ifndef AFFINESCALER_H
+#define AFFINESCALER_H
+
+#include "Scaler.h"
+#include "Vector.h"
+
+/**
+ * @class AffineScaler
+ * @brief Common base for scalers of the form X_scaled = X * scale + offset
+ *
+ * This class demonstrates:
+ * - Template Method pattern: fit() and partialFit() are implemented here
+ *   in terms of three hooks the derived scalers provide
+ *   (resetStatistics, accumulate, computeAffine)
+ * - Code reuse through inheritance: every affine scaler shares one fused,
+ *   multithreaded multiply-add transform
+ *
+ * fit(data) is reset + accumulate(data) + computeAffine; partialFit(chunk)
+ * only accumulates, so a stream of chunks is scaled with parameters learned
+ * in one pass and constant memory.
+ */
+class AffineScaler : public Scaler {
+protected:
+    Vector scale;      // Per-feature multiplier
+    Vector offset;     // Per-feature additive term
+    bool isFitted;     // Flag to check if scaler has been fitted
+    int numFeatures;   // Width of the data seen so far (0 before any chunk)
+
+    // Hooks implemented by the concrete scalers
+    virtual void resetStatistics(int features) = 0;        // Forget everything seen so far
+    virtual void accumulate(const DataView& chunk) = 0;    // Fold a chunk into the statistics
+    virtual void computeAffine() = 0;                      // Statistics -> scale / offset
+    virtual const char* getName() const = 0;               // For progress messages
+
+    void checkFitted(int features) const;  // Throws unless fitted for this width
+
+public:
+    // Constructor
+    AffineScaler();
+
+    // Destructor
+    virtual ~AffineScaler();
+
+    // Scaler interface
+    void fit(const Matrix& data) override;
+    void fit(const DataView& data) override;
+    void partialFit(const Matrix& chunk) override;
+    void partialFit(const DataView& chunk) override;
+    Matrix transform(const Matrix& data) override;
+    Matrix transform(const DataView& data) override;
+    void transformInPlace(Matrix& data) override;
+
+    // Getters
+    Vector getScale() const;
+    Vector getOffset() const;
+    bool getIsFitted() const;
+};
+
+#endif // AFFINESCALER_H
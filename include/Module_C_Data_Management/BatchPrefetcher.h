@@ -0,0 +1,94 @@
+#ifndef BATCHPREFETCHER_H
+#define BATCHPREFETCHER_H
+
+#include <atomic>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Matrix.h"
+#include "Vector.h"
+#include "BoundedQueue.h"
+
+/**
+ * @struct DataBatch
+ * @brief One block of consecutive CSV rows, parsed
+ */
+struct DataBatch {
+    Matrix features;      // Batch feature rows
+    Vector labels;        // Batch labels
+    int pass;             // Pass over the file this batch belongs to
+    long long firstRow;   // Position of the first row within the file
+
+    DataBatch() : pass(0), firstRow(0) {}
+};
+
+/**
+ * @class BatchPrefetcher
+ * @brief Background CSV reading and parsing that overlaps with training
+ *
+ * This class demonstrates:
+ * - Producer/consumer pipeline with bounded queues (backpressure)
+ * - RAII thread ownership: the destructor stops and joins the workers
+ * - Friend access to Dataset's CSV parsing helpers
+ *
+ * Pipeline:
+ *   I/O thread    reads raw lines in blocks of batchSize
+ *   parse thread  converts blocks into DataBatch objects
+ *   consumer      calls next() (e.g. LogisticRegression::trainStream)
+ *
+ * At most `capacity` blocks wait in each stage, so memory stays bounded
+ * and a slow consumer throttles the readers. Batch buffers are recycled:
+ * the batch the consumer passes back into next() is reused by the parse
+ * thread, so steady-state streaming allocates nothing. A single parse
+ * thread keeps batches in file order.
+ */
+class BatchPrefetcher {
+private:
+    std::string filepath;   // Source CSV
+    int batchSize;          // Rows per batch
+    int numPasses;          // Number of times the file is streamed
+    int numColumns;         // Header columns (features + label)
+    std::vector<int> slotOf;  // Field position -> output slot (label last)
+    std::ifstream file;     // Owned by the I/O thread once started
+
+    BoundedQueue<std::vector<std::string>> lineBlocks;  // I/O thread -> parse thread
+    BoundedQueue<DataBatch> readyBatches;               // parse thread -> consumer
+    BoundedQueue<DataBatch> freeBatches;                // consumer -> parse thread (recycled)
+
+    std::thread ioThread;
+    std::thread parseThread;
+    std::atomic<bool> stopping;
+    bool started;
+
+    // Thread bodies
+    void readLoop();
+    void parseLoop();
+
+public:
+    // Constructor
+    BatchPrefetcher(const std::string& filepath, int batchSize, int capacity = 4, int passes = 1);
+
+    // Destructor - stops and joins the background threads
+    ~BatchPrefetcher();
+
+    // Non-copyable: owns threads
+    BatchPrefetcher(const BatchPrefetcher&) = delete;
+    BatchPrefetcher& operator=(const BatchPrefetcher&) = delete;
+
+    // Open the file, read the header and launch the threads (idempotent)
+    bool start();
+
+    // Blocking: swap the next batch into `batch`; false when the stream ends
+    bool next(DataBatch& batch);
+
+    // Cancel the pipeline and join the threads; safe to call repeatedly
+    void stop();
+
+    // Getters
+    int getNumFeatures() const;
+    int getBatchSize() const;
+    int getNumPasses() const;
+};
+
+#endif // BATCHPREFETCHER_H
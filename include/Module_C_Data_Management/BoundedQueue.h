@@ -0,0 +1,95 @@
+#ifndef BOUNDEDQUEUE_H
+#define BOUNDEDQUEUE_H
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <utility>
+
+/**
+ * @class BoundedQueue
+ * @brief Blocking fixed-capacity FIFO shared by producer and consumer threads
+ *
+ * This class demonstrates:
+ * - Class templates (header-only, instantiated per element type)
+ * - Backpressure: push() blocks while the queue is full
+ * - Cooperative shutdown: close() wakes every waiting thread
+ *
+ * After close(), push() fails immediately and pop() drains the remaining
+ * items before failing. popUntil() is pop() with a deadline, for consumers
+ * that group items into batches bounded by a waiting time.
+ */
+template <typename T>
+class BoundedQueue {
+private:
+    std::deque<T> items;
+    size_t capacity;
+    bool closed;
+    std::mutex mutex;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+
+public:
+    // Constructor
+    explicit BoundedQueue(size_t maxItems) : capacity(maxItems == 0 ? 1 : maxItems), closed(false) {}
+
+    // Non-copyable: shared between threads by reference
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    // Blocks while full; returns false if the queue was closed
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notFull.wait(lock, [this] { return closed || items.size() < capacity; });
+        if (closed) {
+            return false;
+        }
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    // Blocks while empty; returns false once closed and drained
+    bool pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return closed || !items.empty(); });
+        if (items.empty()) {
+            return false;
+        }
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    // Like pop(), but also gives up (returns false) once the deadline passes
+    template <typename Clock, typename Duration>
+    bool popUntil(T& item, const std::chrono::time_point<Clock, Duration>& deadline) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait_until(lock, deadline, [this] { return closed || !items.empty(); });
+        if (items.empty()) {
+            return false;
+        }
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    // True once close() has been called (items may still be waiting)
+    bool isClosed() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return closed;
+    }
+
+    // Wake all waiters; no further pushes are accepted
+    void close() {
+        std::lock_guard<std::mutex> lock(mutex);
+        closed = true;
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+};
+
+#endif // BOUNDEDQUEUE_H
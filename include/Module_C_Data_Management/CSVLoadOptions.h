@@ -0,0 +1,55 @@
+#ifndef CSVLOADOPTIONS_H
+#define CSVLOADOPTIONS_H
+
+#include <string>
+#include <vector>
+
+/**
+ * @class CSVLoadOptions
+ * @brief Column projection and row sampling pushed down into the CSV loader
+ *
+ * This class demonstrates:
+ * - Parameter object pattern (one argument instead of many flags)
+ * - Named factory methods for the common sampling schemes
+ *
+ * Features can be selected by header name and/or position; the label
+ * (last column) is always kept. Fields that are not selected, and rows
+ * that are not sampled, are skipped without any number conversion.
+ */
+class CSVLoadOptions {
+public:
+    enum SamplingMode {
+        ALL_ROWS,    // Keep every row
+        EVERY_KTH,   // Keep rows 0, k, 2k, ...
+        BERNOULLI,   // Keep each row independently with a given probability
+        RESERVOIR    // Keep a uniform random sample of exactly n rows
+    };
+
+    // Projection (both empty = every feature column)
+    std::vector<std::string> columnNames;  // Feature columns by header name
+    std::vector<int> columnIndices;        // Feature columns by 0-based position
+
+    // Sampling
+    SamplingMode sampling;
+    int everyK;              // Stride for EVERY_KTH
+    double probability;      // Keep probability for BERNOULLI
+    int reservoirSize;       // Sample size for RESERVOIR
+    unsigned long seed;      // Seed for BERNOULLI and RESERVOIR
+
+    // Constructor - full load
+    CSVLoadOptions();
+
+    // Factory methods
+    static CSVLoadOptions everyKth(int k);
+    static CSVLoadOptions bernoulli(double p, unsigned long seed);
+    static CSVLoadOptions reservoir(int n, unsigned long seed);
+
+    // True if the load keeps every row and every column
+    bool isFullLoad() const;
+
+    // Map a header (features..., label) to the selected feature positions;
+    // throws std::invalid_argument for unknown or repeated columns
+    std::vector<int> resolveColumns(const std::vector<std::string>& header) const;
+};
+
+#endif // CSVLOADOPTIONS_H
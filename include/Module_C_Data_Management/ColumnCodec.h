@@ -0,0 +1,66 @@
+#ifndef COLUMNCODEC_H
+#define COLUMNCODEC_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @struct ColumnEncoding
+ * @brief On-disk descriptor of one compressed column (40 bytes)
+ */
+struct ColumnEncoding {
+    uint8_t codec;            // ColumnCodec::Codec
+    uint8_t bitWidth;         // Bits per packed value (dictionary codes, FOR/delta offsets)
+    uint16_t reserved;
+    uint32_t dictionarySize;  // Number of dictionary entries (DICTIONARY only)
+    uint64_t offset;          // Byte offset of the column data from the start of the file
+    uint64_t size;            // Encoded size in bytes (without alignment padding)
+    double base;              // FOR minimum / DELTA first value
+    double reference;         // DELTA minimum delta
+};
+
+/**
+ * @class ColumnCodec
+ * @brief Lossless lightweight compression of double columns
+ *
+ * This class demonstrates:
+ * - Static utility methods grouped under one class
+ * - Strategy selection: every candidate codec is sized and the smallest wins
+ *
+ * Codecs (all exactly lossless):
+ * - RAW:        8-byte doubles
+ * - FLOAT32:    4-byte floats, when every value survives the round trip
+ * - DICTIONARY: up to 4096 distinct values, bit-packed codes + value table
+ * - FOR:        integer values stored as bit-packed offsets from the minimum
+ * - DELTA:      integer values stored as bit-packed (delta - min delta),
+ *               for sorted or slowly changing columns such as ids
+ *
+ * Bit-packed data is always followed by 8 zero bytes so the decoder can read
+ * every value with one unaligned 64-bit load, a shift and a mask, without
+ * branches. DELTA decoding is a running sum, so each value depends on the
+ * previous one and that loop stays serial (one add per value).
+ */
+class ColumnCodec {
+public:
+    enum Codec {
+        RAW = 0,
+        FLOAT32 = 1,
+        DICTIONARY = 2,
+        FOR = 3,
+        DELTA = 4
+    };
+
+    // Pick the smallest codec for the column and encode it into bytes
+    static void encode(const double* values, size_t count,
+                       ColumnEncoding& encoding, std::vector<unsigned char>& bytes);
+
+    // Decode count values; the bytes must hold encoding.size bytes
+    static void decode(const ColumnEncoding& encoding, const unsigned char* bytes,
+                       size_t count, double* out);
+
+    // Human readable codec name
+    static const char* codecName(int codec);
+};
+
+#endif // COLUMNCODEC_H
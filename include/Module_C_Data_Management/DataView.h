@@ -0,0 +1,70 @@
+#ifndef DATAVIEW_H
+#define DATAVIEW_H
+
+#include <vector>
+#include "Matrix.h"
+#include "Vector.h"
+
+/**
+ * @class DataView
+ * @brief Non-owning row selection over a feature matrix and label vector
+ *
+ * This class demonstrates:
+ * - Composition by reference (the view never copies the underlying data)
+ * - Gather access through a row-index permutation
+ * - Value semantics for cheap, index-only copies
+ *
+ * A view with no index list covers every row in order. Views returned by
+ * Dataset (shuffles, train/test splits, k-fold partitions) keep row indices
+ * only, so many partitions of one large dataset share a single copy of it.
+ * The viewed Matrix/Vector must outlive the view.
+ */
+class DataView {
+private:
+    const Matrix* features;   // Viewed feature matrix (not owned)
+    const Vector* labels;     // Viewed labels (not owned, may be null)
+    std::vector<int> indices; // Selected rows; empty means all rows in order
+    bool identity;            // True when the view covers every row in order
+
+public:
+    // Constructors
+    DataView();
+    explicit DataView(const Matrix& X);  // Explicit: a temporary Matrix would leave the view dangling
+    DataView(const Matrix& X, const Vector& y);
+    DataView(const Matrix& X, const Vector& y, const std::vector<int>& rowIndices);
+
+    // Same row selection over a different matrix with the same number of rows
+    // (e.g. the scaled copy of the features the view was built on)
+    DataView withFeatures(const Matrix& X) const;
+
+    // Shape
+    int getRows() const;
+    int getCols() const;
+    bool hasLabels() const;
+    bool isIdentity() const;
+
+    // Gather access: i is the position within the view
+    int rowIndex(int i) const;
+    const double* row(int i) const;
+    double getValue(int i, int col) const;
+    double getLabel(int i) const;
+    const std::vector<int>& getIndices() const;
+
+    // Explicit materialization when a dense copy is really needed
+    Matrix gatherFeatures() const;
+    Vector gatherLabels() const;
+
+    // Deterministic Fisher-Yates shuffle of an index list
+    static void shuffleIndices(std::vector<int>& indices, unsigned long seed);
+};
+
+/**
+ * @struct DataSplit
+ * @brief A pair of disjoint views over the same data (train / test)
+ */
+struct DataSplit {
+    DataView train;
+    DataView test;
+};
+
+#endif // DATAVIEW_H
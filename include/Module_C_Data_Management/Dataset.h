@@ -2,8 +2,11 @@
 #define DATASET_H
 
 #include <string>
+#include <vector>
 #include "Matrix.h"
 #include "Vector.h"
+#include "DataView.h"
+#include "CSVLoadOptions.h"
 
 /**
  * @class Dataset
@@ -14,6 +17,8 @@
  * - Encapsulation of data and labels
  * - Data structure management
  * - String manipulation for parsing
+ * - Binary columnar caching (see DatasetCache) to skip re-parsing
+ * - Copy-free partitioning: shuffles, splits and folds are DataViews
  */
 class Dataset {
 private:
@@ -22,6 +27,15 @@ private:
     std::string filename; // Source file path
     int numSamples;       // Number of data samples
     int numFeatures;      // Number of features
+    std::vector<std::string> columnNames;  // Header names (features..., label)
+    bool cacheEnabled;    // Read/write the binary cache next to the CSV
+    
+    // Shuffled row indices, grouped per label value when stratifying
+    std::vector<std::vector<int>> shuffledGroups(unsigned long seed, bool stratify) const;
+    
+    // CSV parsing helpers
+    static const std::string& trimLine(std::string& line);
+    static bool parseRow(const std::string& line, const std::vector<int>& slotOf, double* out);
 
 public:
     // Constructor
@@ -33,17 +47,36 @@ public:
     
     // File operations
     bool loadCSV(const std::string& filepath);
+    bool loadCSV(const std::string& filepath, const CSVLoadOptions& options);  // Projection + sampling
+    void setCacheEnabled(bool enabled);  // Enabled by default
     
-    // Getters
-    Matrix getFeatures() const;
-    Vector getLabels() const;
+    // Getters (by reference: the loaded data exists exactly once)
+    const Matrix& getFeatures() const;
+    const Vector& getLabels() const;
     int getNumSamples() const;
     int getNumFeatures() const;
+    std::vector<std::string> getColumnNames() const;
     void getShape() const;  // Display dataset dimensions
     
+    // Move the loaded data out; the dataset reports an empty shape afterwards
+    Matrix releaseFeatures();
+    Vector releaseLabels();
+    
+    // Index-based partitioning (no feature data is copied)
+    DataView view() const;                                        // All rows in order
+    DataView shuffled(unsigned long seed) const;                  // Seeded permutation
+    DataSplit trainTestSplit(double testRatio, unsigned long seed,
+                             bool stratify = true) const;         // Train/test views
+    std::vector<DataSplit> kFold(int k, unsigned long seed,
+                                 bool stratify = true) const;     // k train/validation views
+    
     // Display methods
     void displayHead(int n = 5) const;  // Show first n rows
     void displayInfo() const;            // Show dataset information
+    
+    // Friend class declaration
+    friend class BatchPrefetcher;  // Streams batches with the same CSV parsing helpers
+    friend class FeatureHasher;    // Hashes categorical CSVs with the same line handling
 };
 
 #endif // DATASET_H
@@ -0,0 +1,56 @@
+#ifndef DATASETCACHE_H
+#define DATASETCACHE_H
+
+#include <string>
+#include <vector>
+#include "Matrix.h"
+#include "Vector.h"
+#include "CSVLoadOptions.h"
+
+/**
+ * @class DatasetCache
+ * @brief Binary columnar cache for parsed CSV datasets
+ *
+ * This class demonstrates:
+ * - Static utility methods (no instance state, like Evaluation)
+ * - Binary file I/O with a versioned, checksummed layout
+ * - Memory-mapped loading through MappedFile
+ *
+ * File layout (all sections aligned to 64 bytes):
+ *   [header]    magic, version, column count, row count,
+ *               source CSV size + modification time, payload checksum
+ *   [schema]    length-prefixed column names (features..., label)
+ *   [directory] one ColumnEncoding per column (codec, offset, parameters)
+ *   [columns]   one compressed block per column, label last
+ *
+ * Each column is stored with the smallest lossless ColumnCodec (raw,
+ * float32, dictionary, frame-of-reference or delta bit-packing), so
+ * low-cardinality and integer columns cost a fraction of raw doubles.
+ *
+ * The cache lives next to the CSV ("<file>.tlcache") and is rejected
+ * whenever the CSV's size or modification time no longer match the
+ * values recorded in the header, so editing the CSV invalidates it.
+ * Column projections are served from the cache by copying only the
+ * selected columns; sampled loads always go back to the CSV.
+ */
+class DatasetCache {
+public:
+    // Cache file location for a given CSV file
+    static std::string cachePathFor(const std::string& csvPath);
+
+    // Write the parsed dataset; returns false if the cache could not be written
+    static bool save(const std::string& csvPath,
+                     const std::vector<std::string>& columnNames,
+                     const Matrix& features,
+                     const Vector& labels);
+
+    // Load a valid, up-to-date cache; returns false if missing, stale or corrupt,
+    // or if the options ask for row sampling
+    static bool load(const std::string& csvPath,
+                     std::vector<std::string>& columnNames,
+                     Matrix& features,
+                     Vector& labels,
+                     const CSVLoadOptions& options = CSVLoadOptions());
+};
+
+#endif // DATASETCACHE_H
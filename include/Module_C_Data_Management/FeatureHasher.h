@@ -0,0 +1,65 @@
+#ifndef FEATUREHASHER_H
+#define FEATUREHASHER_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include "SparseMatrix.h"
+#include "Vector.h"
+
+/**
+ * @class FeatureHasher
+ * @brief Hashing-trick featurizer for mixed numeric / categorical CSV data
+ *
+ * This class demonstrates:
+ * - The hashing trick: features are mapped to columns by a hash, so no
+ *   vocabulary map is ever built and memory does not grow with the number
+ *   of distinct categories
+ * - Sparse output (SparseMatrix) for very wide feature spaces
+ *
+ * Every feature field becomes one entry in a space of 2^numBits columns:
+ * - numeric field  "x"   -> column h(name),         value  x
+ *   ("nan", "inf" and out-of-range numbers are parse errors, not categories)
+ * - string field   "red" -> column h(name "=" red), value  1
+ * - empty field          -> nothing (missing)
+ * With alternateSign, the value is multiplied by a sign taken from another
+ * bit of the same hash, so collisions cancel in expectation instead of
+ * piling up.
+ */
+class FeatureHasher {
+private:
+    int numBits;          // Output width is 2^numBits
+    uint32_t mask;        // numFeatures - 1
+    bool alternateSign;   // Signed hashing to unbias collisions
+
+    static uint64_t hashBytes(uint64_t seed, const char* begin, const char* end);
+
+public:
+    // Constructor
+    explicit FeatureHasher(int bits = 18, bool signedHash = true);
+
+    // Destructor
+    ~FeatureHasher();
+
+    // Hash state for a column name; reused for every field of that column
+    uint64_t columnSeed(const std::string& name) const;
+
+    // Append the entry for one field text [begin, end) to the row. Returns
+    // false, appending nothing, for a number that is NaN or infinite
+    bool hashField(uint64_t seed, const char* begin, const char* end,
+                   std::vector<std::pair<int, double>>& row) const;
+
+    // Parse a CSV (header row, label in the last column) straight into
+    // hashed sparse features. Rows with a missing or non-numeric label, or
+    // with a NaN / infinite number in any field, are skipped with a parse
+    // error. Returns false if the file cannot be read or has no rows.
+    bool loadCSV(const std::string& filepath, SparseMatrix& features, Vector& labels) const;
+
+    // Getters
+    int getNumFeatures() const;
+    int getNumBits() const;
+    bool getAlternateSign() const;
+};
+
+#endif // FEATUREHASHER_H
@@ -0,0 +1,52 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a binary file
+ *
+ * This class demonstrates:
+ * - RAII ownership of an operating system resource (the mapping)
+ * - Non-copyable resource handle (copy operations are deleted)
+ * - Platform abstraction (mmap on POSIX, buffered read elsewhere)
+ *
+ * Used by the binary dataset cache so that repeated loads only touch
+ * the page cache instead of re-parsing CSV text.
+ */
+class MappedFile {
+private:
+    const unsigned char* bytes;         // Start of the mapped region
+    size_t length;                      // Size of the mapped region in bytes
+    std::vector<unsigned char> buffer;  // Fallback storage when mmap is unavailable
+    bool mapped;                        // True if bytes points into an mmap region
+
+public:
+    // Constructor
+    MappedFile();
+
+    // Destructor
+    ~MappedFile();
+
+    // Non-copyable: the mapping has a single owner
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // File operations
+    bool open(const std::string& filepath);
+    void close();
+
+    // Getters
+    const unsigned char* getData() const;
+    size_t getSize() const;
+    bool isOpen() const;
+
+    // 64-bit FNV-1a checksum used by the binary file formats
+    static uint64_t checksum(const void* data, size_t size, uint64_t seed = 14695981039346656037ULL);
+};
+
+#endif // MAPPEDFILE_H
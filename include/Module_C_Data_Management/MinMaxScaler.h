@@ -1,7 +1,7 @@
 #ifndef MINMAXSCALER_H
 #define MINMAXSCALER_H
 
-#include "Scaler.h"
+#include "AffineScaler.h"
 #include "Vector.h"
 
 /**
@@ -9,18 +9,31 @@
  * @brief Scales features to a fixed range [0, 1]
  * 
  * This class demonstrates:
- * - Inheritance from abstract Scaler class
+ * - Inheritance from abstract Scaler class (through AffineScaler)
  * - Implementation of pure virtual methods
  * - Polymorphism in action
  * - Feature normalization algorithm
  * 
  * Formula: X_scaled = (X - X_min) / (X_max - X_min)
+ * 
+ * Implemented as one multiply-add per element with per-feature
+ * scale = 1 / (X_max - X_min) and offset = -X_min * scale. Statistics are
+ * gathered in one row-wise pass that updates every feature's min/max per
+ * row, so the inner loop is contiguous and vectorizes; row blocks are
+ * split across threads (Parallel). Running min/max make partialFit exact.
  */
-class MinMaxScaler : public Scaler {
+class MinMaxScaler : public AffineScaler {
 private:
     Vector minValues;  // Minimum value for each feature
     Vector maxValues;  // Maximum value for each feature
-    bool isFitted;     // Flag to check if scaler has been fitted
+    bool hasData;      // False until the first row has been seen
+
+protected:
+    // AffineScaler hooks
+    void resetStatistics(int features) override;
+    void accumulate(const DataView& chunk) override;   // Update running min and max
+    void computeAffine() override;
+    const char* getName() const override;
 
 public:
     // Constructor
@@ -29,14 +42,9 @@ public:
     // Destructor
     ~MinMaxScaler();
     
-    // Implementation of pure virtual methods
-    void fit(const Matrix& data) override;           // Learn min and max values
-    Matrix transform(const Matrix& data) override;   // Apply min-max scaling
-    
     // Getters
     Vector getMinValues() const;
     Vector getMaxValues() const;
-    bool getIsFitted() const;
 };
 
 #endif // MINMAXSCALER_H
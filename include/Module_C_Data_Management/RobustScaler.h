@@ -0,0 +1,50 @@
+#ifndef ROBUSTSCALER_H
+#define ROBUSTSCALER_H
+
+#include "AffineScaler.h"
+#include "QuantileSketch.h"
+#include "Vector.h"
+#include <vector>
+
+/**
+ * @class RobustScaler
+ * @brief Scales features by median and interquartile range
+ *
+ * This class demonstrates:
+ * - Inheritance from AffineScaler (Template Method hooks)
+ * - Composition with Module B's QuantileSketch
+ *
+ * Formula: X_scaled = (X - median) / (Q3 - Q1)
+ *
+ * Outliers barely move the median and quartiles, so this is the scaler to
+ * use on heavy-tailed features. Each feature keeps three P-square sketches
+ * (Q1, median, Q3): fixed memory per feature however many chunks are seen.
+ * The quantiles are estimates once a feature has more than five values.
+ * Features with zero IQR are centered only (scale 1).
+ */
+class RobustScaler : public AffineScaler {
+private:
+    std::vector<QuantileSketch> lowerQuartiles;  // Q1 per feature
+    std::vector<QuantileSketch> medians;         // Q2 per feature
+    std::vector<QuantileSketch> upperQuartiles;  // Q3 per feature
+
+protected:
+    // AffineScaler hooks
+    void resetStatistics(int features) override;
+    void accumulate(const DataView& chunk) override;   // Columns in parallel
+    void computeAffine() override;
+    const char* getName() const override;
+
+public:
+    // Constructor
+    RobustScaler();
+
+    // Destructor
+    ~RobustScaler();
+
+    // Getters
+    Vector getMedians() const;
+    Vector getInterquartileRanges() const;
+};
+
+#endif // ROBUSTSCALER_H
@@ -2,6 +2,7 @@
 #define SCALER_H
 
 #include "Matrix.h"
+#include "DataView.h"
 
 /**
  * @class Scaler
@@ -21,6 +22,25 @@ public:
     // Pure virtual methods - must be implemented by derived classes
     virtual void fit(const Matrix& data) = 0;           // Learn scaling parameters
     virtual Matrix transform(const Matrix& data) = 0;   // Apply scaling transformation
+    virtual void partialFit(const Matrix& chunk) = 0;   // Update parameters with one more chunk
+    
+    // Overwrite the input with its scaled values; the default goes through
+    // transform(), concrete scalers override it to avoid the extra matrix
+    virtual void transformInPlace(Matrix& data) {
+        data = transform(data);
+    }
+    
+    // Row-view overloads; the defaults materialize the view, concrete
+    // scalers override them to read the selected rows in place
+    virtual void fit(const DataView& data) {
+        fit(data.gatherFeatures());
+    }
+    virtual Matrix transform(const DataView& data) {
+        return transform(data.gatherFeatures());
+    }
+    virtual void partialFit(const DataView& chunk) {
+        partialFit(chunk.gatherFeatures());
+    }
     
     // Convenience method combining fit and transform
     virtual Matrix fitTransform(const Matrix& data) {
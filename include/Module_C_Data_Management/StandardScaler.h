@@ -0,0 +1,50 @@
+#ifndef STANDARDSCALER_H
+#define STANDARDSCALER_H
+
+#include "AffineScaler.h"
+#include "Vector.h"
+
+/**
+ * @class StandardScaler
+ * @brief Scales features to zero mean and unit variance
+ *
+ * This class demonstrates:
+ * - Inheritance from AffineScaler (Template Method hooks)
+ * - Numerically stable streaming statistics
+ *
+ * Formula: X_scaled = (X - mean) / std   (population standard deviation)
+ *
+ * Each chunk is summarized with Welford's update (row-wise, so all features
+ * advance together), row blocks run in parallel, and partial summaries are
+ * merged with Chan's pairwise formula. Only count, mean and M2 per feature
+ * are kept, so partialFit over any number of chunks uses constant memory
+ * and gives the same result as fitting the concatenated data.
+ * Constant features are centered only (scale 1).
+ */
+class StandardScaler : public AffineScaler {
+private:
+    double count;  // Rows seen so far
+    Vector means;  // Running mean per feature
+    Vector m2;     // Running sum of squared deviations per feature
+
+protected:
+    // AffineScaler hooks
+    void resetStatistics(int features) override;
+    void accumulate(const DataView& chunk) override;   // Welford + Chan merge
+    void computeAffine() override;
+    const char* getName() const override;
+
+public:
+    // Constructor
+    StandardScaler();
+
+    // Destructor
+    ~StandardScaler();
+
+    // Getters
+    Vector getMeans() const;
+    Vector getStandardDeviations() const;
+    double getCount() const;
+};
+
+#endif // STANDARDSCALER_H
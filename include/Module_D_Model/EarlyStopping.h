@@ -0,0 +1,65 @@
+#ifndef EARLYSTOPPING_H
+#define EARLYSTOPPING_H
+
+#include <string>
+#include "Vector.h"
+
+/**
+ * @struct StoppingCriteria
+ * @brief When iterative training may stop before its epoch budget
+ *
+ * Every criterion is off when its value is 0; the first one met stops.
+ */
+struct StoppingCriteria {
+    double lossTolerance = 0.0;      // |previous - current| training loss below this
+    double gradientTolerance = 0.0;  // ||gradient||_2 below this (full-batch only)
+    int patience = 0;                // Validation epochs allowed without improvement
+    double minImprovement = 0.0;     // Validation loss decrease that counts as improvement
+};
+
+/**
+ * @class EarlyStopping
+ * @brief Per-epoch monitor that decides when training has converged
+ *
+ * This class demonstrates:
+ * - Encapsulation of stopping bookkeeping (previous loss, best validation
+ *   loss, stale-epoch counter, best parameters) outside the model
+ * - A snapshot/restore protocol for the best parameters seen
+ *
+ * The model calls update() once per epoch. When a validation view is used,
+ * the parameters with the lowest validation loss are kept and restoreBest()
+ * puts them back after the loop, whichever criterion ended it.
+ */
+class EarlyStopping {
+private:
+    StoppingCriteria criteria;
+    bool monitorValidation;    // Patience / best-weights tracking active
+    double previousLoss;
+    double bestValidationLoss;
+    int bestEpoch;             // 0-based epoch of the best snapshot, -1 = none
+    int staleEpochs;
+    Vector bestWeights;
+    double bestBias;
+    std::string reason;        // Why update() returned true
+
+public:
+    // Constructor
+    EarlyStopping(const StoppingCriteria& stoppingCriteria, bool useValidation);
+
+    // Record one epoch; returns true when training should stop
+    bool update(int epoch, double trainingLoss, double gradientNorm,
+                double validationLoss, const Vector& weights, double bias);
+
+    // Put the best validated parameters back (no-op without validation)
+    void restoreBest(Vector& weights, double& bias) const;
+
+    // Whether the caller must compute the training loss every epoch
+    bool needsTrainingLoss() const;
+
+    // Getters
+    int getBestEpoch() const;
+    double getBestValidationLoss() const;
+    const std::string& getReason() const;
+};
+
+#endif // EARLYSTOPPING_H
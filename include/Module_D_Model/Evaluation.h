@@ -2,6 +2,7 @@
 #define EVALUATION_H
 
 #include "Vector.h"
+#include "Matrix.h"
 #include "LogisticRegression.h"
 
 /**
@@ -36,6 +37,14 @@ public:
     // Display confusion matrix
     static void displayConfusionMatrix(const Vector& predictions, const Vector& actual);
     
+    // Multi-class metrics (labels are class indices 0 .. numClasses-1);
+    // calculateAccuracy already works for any number of classes
+    static Matrix confusionMatrix(const Vector& predictions, const Vector& actual, int numClasses);
+    static double calculateMacroF1(const Vector& predictions, const Vector& actual, int numClasses);
+    // Whole number in [0, numClasses); safe for NaN, inf and huge values,
+    // so callers check with it before casting a label to int
+    static bool isClassIndex(double value, int numClasses);
+    
     // Friend function to access private members of LogisticRegression
     static void analyzeModel(const LogisticRegression& model);
 };
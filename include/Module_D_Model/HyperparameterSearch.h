@@ -0,0 +1,130 @@
+#ifndef HYPERPARAMETERSEARCH_H
+#define HYPERPARAMETERSEARCH_H
+
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "DataView.h"
+
+class LogisticRegression;
+
+/**
+ * @struct HyperparameterConfig
+ * @brief One LogisticRegression training setting
+ */
+struct HyperparameterConfig {
+    double learningRate = 0.1;
+    int epochs = 100;
+    int batchSize = 0;  // 0 = full-batch gradient descent
+};
+
+/**
+ * @struct TrialResult
+ * @brief Outcome of one configuration in a search
+ */
+struct TrialResult {
+    HyperparameterConfig config;
+    double score = 0.0;         // Validation metric of the last rung reached (higher is better)
+    double logLoss = 0.0;       // Validation log-loss at that rung (tie-breaker)
+    int epochsTrained = 0;      // Epochs trained by the end of the last rung reached
+    int rungReached = 0;        // 0 = eliminated in the first rung
+    std::string error;          // Non-empty if training threw
+};
+
+/**
+ * @struct SearchResult
+ * @brief All trials of a search, best first
+ */
+struct SearchResult {
+    std::vector<TrialResult> trials;  // Sorted: survivors of later rungs first, then by score
+    int rungs = 0;                    // Rungs actually run
+    long long epochsUsed = 0;         // Training epochs spent over all rungs (survivors only pay the extra ones)
+    long long epochsFullGrid = 0;     // Epochs a plain search (every config to the end) would spend
+    double seconds = 0.0;
+
+    const TrialResult& best() const { return trials.front(); }
+};
+
+/**
+ * @class HyperparameterSearch
+ * @brief Grid / random search over LogisticRegression settings with successive halving
+ *
+ * This class demonstrates:
+ * - A worker pool of std::threads pulling trials from an atomic counter
+ * - Many models training against one shared, read-only feature matrix
+ *   (every trial takes DataViews, so no data is copied or re-parsed)
+ * - Static factory methods for the grid and random candidate lists
+ *
+ * Successive halving: with reduction factor eta and R rungs, rung r trains
+ * every surviving configuration up to eta^(r - R + 1) of its own epochs,
+ * scores it on the validation rows with Evaluation, and keeps the best
+ * 1 / eta for the next rung; the last rung trains the survivors to their
+ * full epochs. A survivor keeps its model between rungs and only runs the
+ * extra epochs (LogisticRegression::continueTraining), which ends exactly
+ * where a fresh run of that length would. Unpromising settings are dropped
+ * after a small fraction of their budget, so the search spends little more
+ * than the cost of the single best run instead of the cost of every run.
+ *
+ * Each trial's model gets a thread budget (LogisticRegression::
+ * setThreadBudget) of the Parallel thread count divided by the trials
+ * running at once, so the cores go to whole trainings rather than to
+ * nested fork-join loops. The process-wide Parallel setting is never
+ * changed, so other code running during a search keeps all its threads.
+ */
+class HyperparameterSearch {
+public:
+    // Validation metric used for ranking
+    enum Metric { ACCURACY, F1_SCORE };
+
+private:
+    int workers;             // Concurrent trainings; 0 = one per hardware thread
+    int reductionFactor;     // eta: 1 / eta of the configurations survive each rung
+    int rungs;               // Rungs including the final full-budget one
+    Metric metric;
+    unsigned long seed;      // Shuffle seed shared by every trial
+
+    // Train (or continue) and score the configurations at the given
+    // positions of trials up to fraction of their epochs
+    void runRung(std::vector<TrialResult>& trials, std::vector<std::unique_ptr<LogisticRegression>>& models,
+                 const std::vector<int>& positions, double fraction, int rung,
+                 const DataView& train, const DataView& validation) const;
+
+public:
+    // Constructor
+    HyperparameterSearch(int numWorkers = 0, int eta = 3, int numRungs = 3);
+
+    // Every combination of the given values
+    static std::vector<HyperparameterConfig> grid(const std::vector<double>& learningRates,
+                                                  const std::vector<int>& epochs,
+                                                  const std::vector<int>& batchSizes = {0});
+
+    // count settings with a log-uniform learning rate in [minRate, maxRate],
+    // uniform epochs in [minEpochs, maxEpochs] and a batch size from the list
+    static std::vector<HyperparameterConfig> random(int count, double minRate, double maxRate,
+                                                    int minEpochs, int maxEpochs,
+                                                    const std::vector<int>& batchSizes, unsigned long seed);
+
+    // Run successive halving over the configurations (throws
+    // std::invalid_argument for an empty list or unlabelled views)
+    SearchResult run(const std::vector<HyperparameterConfig>& configs,
+                     const DataView& train, const DataView& validation) const;
+
+    // Print the top trials
+    static void displayResults(const SearchResult& result, int top = 5, std::ostream& os = std::cout);
+
+    // Getters
+    int getWorkers() const;  // After resolving 0 to the hardware thread count
+    int getReductionFactor() const;
+    int getRungs() const;
+    Metric getMetric() const;
+
+    // Setters
+    void setWorkers(int count);
+    void setReductionFactor(int eta);
+    void setRungs(int count);
+    void setMetric(Metric validationMetric);
+    void setSeed(unsigned long shuffleSeed);
+};
+
+#endif // HYPERPARAMETERSEARCH_H
@@ -0,0 +1,35 @@
+#ifndef LBFGSOPTIMIZER_H
+#define LBFGSOPTIMIZER_H
+
+#include "Optimizer.h"
+
+/**
+ * @class LBFGSOptimizer
+ * @brief Limited-memory BFGS with a backtracking (Armijo) line search
+ *
+ * This class demonstrates:
+ * - Inheritance from the Optimizer interface
+ * - Quasi-Newton curvature from the last few (s, y) gradient pairs,
+ *   in O(memory * parameters) space, via the two-loop recursion
+ *
+ * Each accepted step usually costs a single data pass (the unit step is
+ * accepted near the optimum), and convergence is superlinear, so a
+ * well-conditioned logistic problem converges in a few dozen passes.
+ */
+class LBFGSOptimizer : public Optimizer {
+private:
+    int memory;   // Number of (s, y) pairs kept
+
+public:
+    // Constructor
+    LBFGSOptimizer(int maxIter = 100, double tol = 1e-6, int historySize = 10);
+
+    // Destructor
+    ~LBFGSOptimizer();
+
+    // Implementation of Optimizer interface
+    int minimize(LogisticObjective& objective, Vector& theta, std::ostream& log) const override;
+    const char* getName() const override;
+};
+
+#endif // LBFGSOPTIMIZER_H
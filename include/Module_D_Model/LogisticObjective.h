@@ -0,0 +1,54 @@
+#ifndef LOGISTICOBJECTIVE_H
+#define LOGISTICOBJECTIVE_H
+
+#include "Matrix.h"
+#include "Vector.h"
+#include "DataView.h"
+
+/**
+ * @class LogisticObjective
+ * @brief Mean logistic loss over a labelled view, as a function of (w, b)
+ *
+ * This class demonstrates:
+ * - Separation of the objective (what to minimize) from the Optimizer
+ *   (how to minimize it), so solvers are interchangeable
+ * - Parallel reductions with per-block buffers (Parallel::forRange)
+ *
+ * Parameters are packed as theta = [w_0 .. w_{d-1}, b]:
+ *   L(theta)   = 1/m * Σ [log(1 + e^z) - y z],  z = w·x + b
+ *   ∇L(theta)  = 1/m * Σ (p - y) [x, 1]
+ *   ∇²L(theta) = 1/m * Σ p (1 - p) [x, 1][x, 1]^T
+ * plus, with an L2 strength λ, λ/2 ||w||² (λ w in the gradient, λ on the
+ * Hessian diagonal); the bias is not penalized.
+ * Each evaluate() call reads the data exactly once and counts as one pass.
+ * The objective keeps its own copy of the view, so a temporary view may be
+ * passed to the constructor; the viewed Matrix/Vector must still outlive it.
+ * maxThreads caps the blocks of each pass (0 = Parallel::getThreadCount()).
+ */
+class LogisticObjective {
+private:
+    DataView data;          // Copy of the training view (row indices only; the data is not owned)
+    int numParameters;      // Features + 1 (bias)
+    double l2;              // Ridge strength on w
+    int dataPasses;         // evaluate() calls so far
+    int maxThreads;         // Thread cap per pass (0 = no cap)
+
+    double accumulate(const Vector& theta, Vector& gradient, Matrix* hessian);
+
+public:
+    // Constructor
+    explicit LogisticObjective(const DataView& trainingData, double l2Strength = 0.0, int threadCap = 0);
+
+    // Loss and gradient at theta (one pass over the data)
+    double evaluate(const Vector& theta, Vector& gradient);
+
+    // Loss, gradient and Hessian at theta (one pass over the data)
+    double evaluate(const Vector& theta, Vector& gradient, Matrix& hessian);
+
+    // Getters
+    int getNumParameters() const;
+    int getNumSamples() const;
+    int getDataPasses() const;
+};
+
+#endif // LOGISTICOBJECTIVE_H
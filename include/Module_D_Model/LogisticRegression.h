@@ -1,12 +1,32 @@
 #ifndef LOGISTICREGRESSION_H
 #define LOGISTICREGRESSION_H
 
+#include <memory>
+#include <vector>
 #include "Model.h"
 #include "Matrix.h"
 #include "Vector.h"
+#include "SparseMatrix.h"
+#include "AffineScaler.h"
+#include "Optimizer.h"
+#include "EarlyStopping.h"
+#include "Regularizer.h"
 
-// Forward declaration for friend class
+// Forward declarations for friend classes
 class Evaluation;
+class ModelFile;
+class BatchPrefetcher;  // Only referenced; the .cpp includes it
+
+/**
+ * @struct SparseWeights
+ * @brief Compact export of a linear model: only the non-zero weights
+ */
+struct SparseWeights {
+    int numFeatures = 0;          // Width of the dense weight vector
+    std::vector<int> indices;     // Features with non-zero weight, ascending
+    std::vector<double> values;   // Their weights
+    double bias = 0.0;
+};
 
 /**
  * @class LogisticRegression
@@ -23,20 +43,131 @@ class Evaluation;
  * - Sigmoid function: σ(z) = 1 / (1 + e^(-z))
  * - Cost function: J(θ) = -1/m * Σ[y*log(h) + (1-y)*log(1-h)]
  * - Gradient: ∇J(θ) = 1/m * X^T * (h - y)
+ *
+ * Training modes: with batchSize 0 every epoch is one full-batch step;
+ * with setBatchSize(b) every epoch visits the rows in a fresh seeded
+ * random order and updates after each b rows (mini-batch SGD), so one
+ * pass over the data makes m / b updates instead of one.
+ *
+ * Full-batch epochs fuse the forward pass, gradient and loss into one
+ * pass over the rows, run on all cores (Parallel::forRange), each thread
+ * accumulating into its own buffer. setThreadBudget(n) caps every
+ * parallel loop of this model (training, optimizer objective, scoring) at
+ * n threads without touching the process-wide Parallel setting, so
+ * several models can train side by side.
+ * Sparse mini-batch training can instead run asynchronously (Hogwild):
+ * threads update the shared weights lock-free, with no reduction step.
+ * With setOptimizer(), dense training is delegated to a second-order
+ * solver (LBFGSOptimizer, NewtonOptimizer) that converges in tens of
+ * passes; getDataPasses() reports the passes any mode actually used.
+ * Gradient-descent modes stop early on StoppingCriteria (loss change,
+ * gradient norm, validation patience); with patience set they score the
+ * validation rows every epoch and restore the best validated weights.
+ * getEpochsRun() reports the epochs actually completed.
+ *
+ * Regularization (setRegularizer): L2, L1 or elastic net on the weights.
+ * Gradient-descent modes take a step on the loss plus the L2 part and then
+ * soft-threshold for the L1 part, so L1 drives weights exactly to zero;
+ * optimizers accept L2 only. After training the non-zero weights are kept
+ * as an index/value list: getSparseWeights() exports it, and predictProba
+ * on dense rows scores through it (cost O(non-zeros)) once at most half
+ * of the weights are non-zero.
+ *
+ * Online learning (partialFit): each call makes one shuffled pass of
+ * mini-batch AdaGrad updates over only the new rows, starting from the
+ * current weights. AdaGrad keeps a per-weight sum of squared gradients G
+ * and steps w_j -= lr * g_j / sqrt(G_j), so frequently updated weights
+ * settle while rarely seen ones still move. Those sums persist across
+ * calls; a full train() (or loading weights) starts them over. Refreshing
+ * a model therefore costs one pass over the new batch, not over all history.
+ *
+ * Scaler folding: a model trained on X * s + o computes
+ *   z = b + Σ w_j (x_j s_j + o_j) = (b + Σ w_j o_j) + Σ (w_j s_j) x_j
+ * so foldScaler() returns an equivalent model with w' = w * s and
+ * b' = b + w·o that scores raw features with no transform pass. The
+ * folded model remembers s, o and the scaled-space w, b: its AdaGrad sums
+ * belong to that space, and a diagonal step in raw coordinates is not the
+ * same update (nor a stable one for uncentred features). partialFit on
+ * raw rows therefore scales them, steps in the scaled space and folds
+ * again, making exactly the update the model + scaler pipeline would.
  */
 class LogisticRegression : public Model {
+public:
+    // Learning rate as a function of the epoch (pass) number t:
+    // CONSTANT lr, INVERSE_TIME lr / (1 + decay * t), EXPONENTIAL lr * decay^t
+    enum LearningRateSchedule { CONSTANT, INVERSE_TIME, EXPONENTIAL };
+
 private:
     Vector weights;         // Model weights (parameters)
     double bias;            // Bias term
     double learningRate;    // Learning rate for gradient descent
     int epochs;             // Number of training iterations
     bool isTrained;         // Training status flag
+    int batchSize;          // Rows per update; 0 = full batch
+    unsigned long shuffleSeed;           // Seed for the per-epoch row order
+    LearningRateSchedule schedule;       // How the rate decays over epochs
+    double decay;                        // Schedule parameter
+    bool deterministicReduction;         // Fixed-size gradient shards (thread-count independent)
+    bool asynchronous;                   // Lock-free Hogwild updates for sparse mini-batch SGD
+    std::shared_ptr<const Optimizer> optimizer;  // Batch solver (shared by copies); null = gradient descent
+    int dataPasses;                      // Passes over the data used by the last training run
+    StoppingCriteria stopping;           // Early-stopping rules (all off by default)
+    const DataView* validation;          // Held-out rows for patience (not owned, may be null;
+                                         // read only when patience > 0; foldScaler drops it)
+    int epochsRun;                       // Epochs actually completed by the last training run
+    Regularizer regularizer;             // Weight penalty (none by default)
+    std::vector<int> activeIndices;      // Features with non-zero weight, ascending
+    std::vector<double> activeValues;    // Their weights (sparse scoring)
+    Vector squaredGradients;             // AdaGrad sums of squared gradients (partialFit)
+    double biasSquaredGradient;
+    long long partialFitRows;            // Rows absorbed by partialFit since the last train()
+    int partialFitCalls;                 // Seeds each partialFit shuffle
+    Vector foldScale;                    // Scaler folded in by foldScaler (empty if none)
+    Vector foldOffset;
+    Vector scaledWeights;                // Parameters in the scaled space, for partialFit
+    double scaledBias;
+    int threadBudget;                    // Thread cap for this model's loops (0 = Parallel default)
+    bool verbose;                        // Print training progress
     
     // Private helper methods
     double sigmoid(double z) const;              // Sigmoid activation function
     Vector sigmoidVector(const Vector& z) const; // Apply sigmoid to vector
+    // One update on rows order[0..count) of data (rows 0..count when order is
+    // null) with the given rate; dw is caller-owned gradient scratch of
+    // getCols() entries. Returns their mean loss before the update
+    double gradientStep(const DataView& data, const int* order, int count, double rate, Vector& dw);
+    // Forward pass over the same rows: adds X^T (p - y) into g and sum(p - y)
+    // into db, returns the log-likelihood
+    double batchGradient(const DataView& data, const int* order, int count, double* g, double& db) const;
+    // AdaGrad counterpart of gradientStep (dw is scratch); returns the mean loss
+    double adaptiveStep(const DataView& data, const int* order, int count, Vector& dw);
+    void resetOnlineState();                     // Forget the AdaGrad sums (and any folded scaler)
+    void partialFitFolded(const DataView& data); // partialFit in the space of the folded scaler
+    std::ostream& progress() const;              // std::cout, or a silent stream
+    bool monitorsValidation() const;             // Validation view set and patience enabled
+    void checkTrainingData(const DataView& data) const;  // Throws before any state change
+    void fitEpochs(const DataView& data, int firstEpoch); // Dense modes from firstEpoch on
+    void trainFullBatch(const DataView& data, int firstEpoch);  // Full-batch gradient descent epochs
+    void trainMiniBatch(const DataView& data, int firstEpoch);  // Shuffled mini-batch SGD epochs
+    void trainSparseSGD(const SparseMatrix& X, const Vector& y);  // Synchronous or Hogwild
+    void trainWithOptimizer(const DataView& data, int firstEpoch);  // L-BFGS, Newton, ...
+    double meanLoss(const DataView& data) const;                  // Log-loss with current parameters
+    void computeProbabilities(const DataView& data, double* out) const;  // Parallel, vectorized sigmoid
+    void finishEarlyStopping(const EarlyStopping& monitor);       // Restore best validated weights
+    void refreshActiveSet();                                      // Weights -> active index/value list
+    int threadsToUse() const;                                     // Budget applied to the thread count
+    bool usesActiveSet() const;                                   // Sparse enough to score through it
+    void computeActiveProbabilities(const DataView& data, double* out) const;  // O(non-zeros) per row
+    // One fused full-batch pass across threads: X^T (p - y) into dw, returns
+    // sum(p - y), and adds up the log-likelihood when that pointer is non-null
+    double accumulateGradient(const DataView& data, Vector& dw, std::vector<double>& scratch,
+                              double* logLikelihood) const;
     
 public:
+    // Fewest sparse rows a thread scores per block in synchronous sparse SGD;
+    // smaller batches are scored on the calling thread alone
+    static const int SPARSE_ROWS_PER_BLOCK = 128;
+    
     // Constructors
     LogisticRegression();
     LogisticRegression(double lr, int numEpochs);
@@ -47,24 +178,69 @@ public:
     // Implementation of Model interface
     void train(const Matrix& X, const Vector& y) override;
     Vector predict(const Matrix& X) override;
+    void train(const DataView& data) override;     // Train on selected rows in place
+    // Continue a dense run after setEpochs() raised the count: runs epochs
+    // getEpochsRun() .. getEpochs()-1 from the current weights
+    void continueTraining(const DataView& data);
+    void trainStream(BatchPrefetcher& batches);    // One update per prefetched batch
+    void train(const SparseMatrix& X, const Vector& y);  // Hashed / sparse features
+    Vector predict(const DataView& data) override;
+    Vector predict(const SparseMatrix& X);
+    
+    // Online updates: one AdaGrad pass over new rows, continuing from the
+    // current parameters (an untrained model starts from zero)
+    void partialFit(const Matrix& X, const Vector& y);
+    void partialFit(const DataView& data);
     
     // Additional methods
     Vector predictProba(const Matrix& X);  // Get probability predictions
+    Vector predictProba(const DataView& data);
+    Vector predictProba(const SparseMatrix& X);
+    LogisticRegression foldScaler(const AffineScaler& scaler) const;  // Model over unscaled features
+    // Mean log-loss of probabilities for labelled rows, with the clipping
+    // training uses
+    static double logLoss(const Vector& probabilities, const DataView& data);
+    SparseWeights getSparseWeights() const;              // Non-zero weights only
+    void setSparseWeights(const SparseWeights& sparse);  // Load a trained model from that form
     void displayInfo() const override;
     
     // Getters
     Vector getWeights() const;
     double getBias() const;
     double getLearningRate() const;
+    double getLearningRateAt(int epoch) const;  // After the schedule is applied
     int getEpochs() const;
+    int getBatchSize() const;
+    bool getDeterministicReduction() const;
+    bool getAsynchronous() const;
+    int getDataPasses() const;
+    int getEpochsRun() const;
+    Regularizer getRegularizer() const;
+    int getActiveFeatureCount() const;  // Non-zero weights after training
     bool getIsTrained() const;
+    long long getPartialFitRows() const;  // Rows absorbed by partialFit since the last train()
+    bool getVerbose() const;
+    int getThreadBudget() const;
+    const DataView* getValidationData() const override;
     
     // Setters
     void setLearningRate(double lr);
     void setEpochs(int numEpochs);
+    void setBatchSize(int rows);                 // 0 restores full-batch training
+    void setShuffleSeed(unsigned long seed);
+    void setVerbose(bool enabled);                 // false silences training progress output
+    void setThreadBudget(int threads);             // 0 restores the Parallel thread count
+    void setDeterministicReduction(bool enabled);  // Reproducible across thread counts
+    void setAsynchronous(bool enabled);            // Hogwild for sparse mini-batch training
+    void setRegularizer(const Regularizer& penalty);  // Regularizer::none() disables it
+    void setOptimizer(std::shared_ptr<const Optimizer> solver);  // nullptr restores gradient descent
+    void setStoppingCriteria(const StoppingCriteria& criteria);
+    void setValidationData(const DataView* view) override;  // nullptr disables validation monitoring
+    void setSchedule(LearningRateSchedule type, double decayRate);
     
     // Friend class declaration
     friend class Evaluation;  // Evaluation can access private members
+    friend class ModelFile;   // Serializes weights and hyperparameters
 };
 
 #endif // LOGISTICREGRESSION_H
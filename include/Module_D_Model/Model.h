@@ -3,6 +3,7 @@
 
 #include "Matrix.h"
 #include "Vector.h"
+#include "DataView.h"
 
 /**
  * @class Model
@@ -23,6 +24,24 @@ public:
     virtual void train(const Matrix& X, const Vector& y) = 0;  // Train the model
     virtual Vector predict(const Matrix& X) = 0;               // Make predictions
     
+    // Row-view overloads; the defaults materialize the view, concrete
+    // models override them to train/predict on the selected rows in place
+    virtual void train(const DataView& data) {
+        train(data.gatherFeatures(), data.gatherLabels());
+    }
+    virtual Vector predict(const DataView& data) {
+        return predict(data.gatherFeatures());
+    }
+    
+    // Held-out rows a model may monitor while training (not owned; nullptr
+    // clears them). Models without early stopping ignore them
+    virtual void setValidationData(const DataView* view) {
+        (void)view;
+    }
+    virtual const DataView* getValidationData() const {
+        return nullptr;
+    }
+    
     // Optional methods with default implementation
     virtual void displayInfo() const {
         std::cout << "Generic Model" << std::endl;
@@ -0,0 +1,40 @@
+#ifndef NEWTONOPTIMIZER_H
+#define NEWTONOPTIMIZER_H
+
+#include "Optimizer.h"
+
+/**
+ * @class NewtonOptimizer
+ * @brief Newton's method / IRLS with a Cholesky solve of the Hessian
+ *
+ * This class demonstrates:
+ * - Inheritance from the Optimizer interface
+ * - Exact second-order steps: each iteration solves (X^T S X) d = g with
+ *   Matrix::solveCholesky
+ *
+ * The backtracking line search evaluates loss and gradient only; X^T S X
+ * is built once per iteration, at the accepted point, so a rejected step
+ * costs one O(n d) pass rather than an O(n d^2) one.
+ *
+ * For logistic loss this is iteratively reweighted least squares (IRLS).
+ * It converges quadratically (typically under ten passes), but the Hessian
+ * costs O(parameters^2) memory and O(parameters^3) per solve, so it is
+ * limited to moderate feature counts (maxParameters).
+ */
+class NewtonOptimizer : public Optimizer {
+private:
+    int maxParameters;   // Refuse larger problems (use L-BFGS instead)
+
+public:
+    // Constructor
+    NewtonOptimizer(int maxIter = 25, double tol = 1e-8, int parameterLimit = 2000);
+
+    // Destructor
+    ~NewtonOptimizer();
+
+    // Implementation of Optimizer interface
+    int minimize(LogisticObjective& objective, Vector& theta, std::ostream& log) const override;
+    const char* getName() const override;
+};
+
+#endif // NEWTONOPTIMIZER_H
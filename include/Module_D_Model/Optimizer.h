@@ -0,0 +1,51 @@
+#ifndef OPTIMIZER_H
+#define OPTIMIZER_H
+
+#include <ostream>
+#include "Vector.h"
+#include "LogisticObjective.h"
+
+/**
+ * @class Optimizer
+ * @brief Abstract interface for batch solvers used by LogisticRegression
+ *
+ * This class demonstrates:
+ * - Strategy pattern: the model delegates "how to minimize" to a
+ *   pluggable object chosen at run time (setOptimizer)
+ * - Interface pattern with a pure virtual minimize()
+ *
+ * minimize() starts from theta and overwrites it with the solution. It
+ * stops when the largest gradient component drops below the tolerance or
+ * after maxIterations; the objective counts the data passes spent.
+ * minimize() is const: a solver holds only its settings, so one instance
+ * can be shared by several models (and by copies of a model) and run from
+ * several threads at once.
+ */
+class Optimizer {
+protected:
+    int maxIterations;   // Upper bound on outer iterations
+    double tolerance;    // Stop when max |gradient component| is below this
+
+public:
+    // Constructor
+    Optimizer(int maxIter, double tol) : maxIterations(maxIter), tolerance(tol) {}
+
+    // Virtual destructor
+    virtual ~Optimizer() {}
+
+    // Pure virtual methods - must be implemented by derived classes.
+    // minimize() writes one line per iteration to log and returns the
+    // number of outer iterations used
+    virtual int minimize(LogisticObjective& objective, Vector& theta, std::ostream& log) const = 0;
+    virtual const char* getName() const = 0;
+
+    // Getters
+    int getMaxIterations() const { return maxIterations; }
+    double getTolerance() const { return tolerance; }
+
+    // Setters
+    void setMaxIterations(int maxIter) { maxIterations = maxIter; }
+    void setTolerance(double tol) { tolerance = tol; }
+};
+
+#endif // OPTIMIZER_H
@@ -0,0 +1,80 @@
+#ifndef PIPELINE_H
+#define PIPELINE_H
+
+#include "Model.h"
+#include "Scaler.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "DataView.h"
+#include <vector>
+
+/**
+ * @class Pipeline
+ * @brief Chains Scaler stages and a final Model behind one fit/predict call
+ *
+ * This class demonstrates:
+ * - Composite pattern: a Pipeline is itself a Model
+ * - Aggregation: stages are owned by the caller and held by reference,
+ *   so they can still be inspected (or folded) after fitting
+ * - Block streaming: rows move through every stage in small blocks that
+ *   stay in cache, instead of one full matrix per stage
+ *
+ * predict() gathers a block of rows, scales it in place through every
+ * stage and scores it before touching the next block, so no intermediate
+ * matrix is ever built. fit() learns each scaler with one streamed
+ * partialFit pass over the rows transformed by the earlier stages, then
+ * materializes only the final model input, which iterative training
+ * has to revisit every epoch anyway.
+ *
+ * Validation rows for the model's early stopping are given to the
+ * pipeline (setValidationData), not to the model: fit() runs them through
+ * the fitted scalers like the training rows and hands the scaled copy to
+ * the model for that training run only.
+ */
+class Pipeline : public Model {
+private:
+    std::vector<Scaler*> scalers;   // Applied in insertion order
+    Model* model;                   // Final estimator (may be null for transform-only use)
+    const DataView* validation;     // Unscaled held-out rows for the model (not owned, may be null)
+    bool isFitted;
+
+    int rowsPerBlock(int cols) const;                                   // Cache-sized block height
+    void scaleBlock(const DataView& data, int begin, int end,
+                    int numStages, Matrix& block) const;                // Gather rows + first stages
+
+public:
+    // Constructor
+    Pipeline();
+
+    // Destructor
+    ~Pipeline();
+
+    // Assembly (stages must outlive the pipeline)
+    Pipeline& addScaler(Scaler& scaler);
+    Pipeline& setModel(Model& finalModel);
+
+    // Unscaled validation rows, scaled and passed to the model during fit()
+    // (nullptr clears them; throws std::invalid_argument without labels)
+    void setValidationData(const DataView* view);
+
+    // Fit every stage in order. Throws std::invalid_argument if validation
+    // rows were set on the model itself while there are scaler stages
+    void fit(const DataView& data);
+    void fit(const Matrix& X, const Vector& y);
+
+    // Scaler stages only, streamed block by block into one output matrix
+    Matrix transform(const DataView& data) const;
+
+    // Implementation of Model interface
+    void train(const Matrix& X, const Vector& y) override;
+    void train(const DataView& data) override;
+    Vector predict(const Matrix& X) override;
+    Vector predict(const DataView& data) override;
+    void displayInfo() const override;
+
+    // Getters
+    int getNumScalers() const;
+    bool getIsFitted() const;
+};
+
+#endif // PIPELINE_H
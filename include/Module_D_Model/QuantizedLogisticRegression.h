@@ -0,0 +1,96 @@
+#ifndef QUANTIZEDLOGISTICREGRESSION_H
+#define QUANTIZEDLOGISTICREGRESSION_H
+
+#include <cstdint>
+#include <vector>
+#include "Vector.h"
+#include "DataView.h"
+#include "LogisticRegression.h"
+
+/**
+ * @struct QuantizedRows
+ * @brief Feature rows stored as int8 codes of a QuantizedLogisticRegression
+ *
+ * Rows are padded to a multiple of ROW_ALIGNMENT bytes with zero codes, so
+ * every row starts on an aligned boundary and the dot product needs no tail.
+ */
+struct QuantizedRows {
+    static const int ROW_ALIGNMENT = 32;
+
+    int rows = 0;
+    int cols = 0;
+    int stride = 0;              // Bytes per row (cols rounded up)
+    std::vector<int8_t> codes;   // rows x stride
+
+    const int8_t* row(int i) const { return codes.data() + static_cast<size_t>(i) * stride; }
+    int8_t* row(int i) { return codes.data() + static_cast<size_t>(i) * stride; }
+};
+
+/**
+ * @class QuantizedLogisticRegression
+ * @brief int8 inference copy of a trained LogisticRegression
+ *
+ * This class demonstrates:
+ * - Post-training quantization with calibration on sample data
+ * - Folding per-feature scales into the weights so scoring is one
+ *   integer dot product per row
+ * - Auto-vectorized int8 x int8 -> int32 kernels (see TITANLEARN_NATIVE_ARCH)
+ *
+ * Calibration records each feature's range [lo_j, hi_j] on a sample and
+ * maps it linearly onto the codes -127..127:
+ *   x_j ~ center_j + step_j * q_j,  step_j = (hi_j - lo_j) / 254
+ * Values outside the calibrated range are clipped. Substituting into the
+ * linear score gives
+ *   z = b + sum_j w_j center_j + sum_j (w_j step_j) q_j
+ * The first two terms fold into one bias; the folded weights w_j step_j
+ * share a single scale and are stored as int8 codes r_j, so
+ *   z ~ bias + weightStep * sum_j r_j q_j
+ * where the sum is exact in integer arithmetic.
+ *
+ * Quantized rows take one byte per feature instead of eight. Keeping a
+ * batch as QuantizedRows is the high-throughput path; predictProba on a
+ * DataView quantizes each row on the fly.
+ */
+class QuantizedLogisticRegression {
+private:
+    int numFeatures;
+    int stride;                          // Padded row length in bytes
+    std::vector<double> center;          // Per-feature code 0
+    std::vector<double> inverseStep;     // Per-feature 1 / step (0 for constant features)
+    std::vector<int8_t> weightCodes;     // Folded weights as codes, padded to stride
+    double weightStep;                   // Value of one weight code
+    double bias;                         // Bias with every center folded in
+
+    // Linear scores for rows [first, first + count) into z
+    void scoreRows(const QuantizedRows& rows, int first, int count, double* z) const;
+
+public:
+    // Constructors
+    QuantizedLogisticRegression();
+    // Quantize a trained model, with feature ranges taken from a calibration sample
+    QuantizedLogisticRegression(const LogisticRegression& model, const DataView& calibration);
+
+    // Convert rows to int8 codes (clipped to the calibrated ranges)
+    QuantizedRows quantize(const DataView& data) const;
+    void quantizeRow(const double* x, int8_t* codes) const;
+
+    // Integer dot product of two code arrays of length n (padded rows)
+    static int64_t dot(const int8_t* a, const int8_t* b, int n);
+
+    // Scoring on pre-quantized rows (the fast path) or on double rows
+    Vector predictProba(const QuantizedRows& rows) const;
+    Vector predictProba(const DataView& data) const;
+    Vector predict(const QuantizedRows& rows) const;  // Threshold at 0.5
+    Vector predict(const DataView& data) const;
+
+    // Getters
+    int getNumFeatures() const;
+    double getWeightStep() const;
+    double getBias() const;
+    const std::vector<int8_t>& getWeightCodes() const;
+
+    // Display
+    void displayInfo() const;
+};
+
+#endif // QUANTIZEDLOGISTICREGRESSION_H
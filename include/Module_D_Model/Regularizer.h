@@ -0,0 +1,63 @@
+#ifndef REGULARIZER_H
+#define REGULARIZER_H
+
+#include "Vector.h"
+
+/**
+ * @class Regularizer
+ * @brief Weight penalty added to the mean training loss (the bias is never penalized)
+ *
+ * This class demonstrates:
+ * - Value object with named factory methods (none, l2, l1, elasticNet)
+ * - Splitting a penalty into a smooth part (added to the gradient) and a
+ *   non-smooth part (applied by a proximal step after the gradient step)
+ *
+ * Elastic-net form, with strength λ and mixing ratio α in [0, 1]:
+ *   R(w) = λ α Σ|w_j| + λ (1 - α) / 2 Σ w_j²
+ * L2 is α = 0, L1 is α = 1. A gradient step of size η on the loss plus the
+ * smooth part is followed by soft-thresholding:
+ *   w_j <- sign(w_j) max(|w_j| - η λ α, 0)
+ * which sets small weights exactly to zero, so L1-trained models are sparse.
+ */
+class Regularizer {
+public:
+    enum Type { NONE, L2, L1, ELASTIC_NET };
+
+private:
+    Type type;
+    double strength;  // λ
+    double l1Ratio;   // α
+
+public:
+    // Constructors
+    Regularizer();  // No penalty
+    Regularizer(Type penaltyType, double lambda, double ratio);
+
+    // Named factories
+    static Regularizer none();
+    static Regularizer l2(double lambda);
+    static Regularizer l1(double lambda);
+    static Regularizer elasticNet(double lambda, double ratio);
+
+    // R(w) for the first n weights
+    double penalty(const double* w, int n) const;
+    double penalty(const Vector& w) const;
+
+    // grad += ∇ of the smooth (L2) part
+    void addGradient(const double* w, double* grad, int n) const;
+
+    // Soft-threshold after a gradient step of size step (no-op without L1)
+    void proximalStep(double* w, int n, double step) const;
+
+    // Getters
+    Type getType() const;
+    double getStrength() const;
+    double getL1Ratio() const;
+    double getL1() const;  // λ α
+    double getL2() const;  // λ (1 - α)
+    bool isActive() const;
+    bool isSmooth() const;  // No L1 part, so gradient-based solvers apply
+    const char* getName() const;
+};
+
+#endif // REGULARIZER_H
@@ -0,0 +1,127 @@
+#ifndef SCORINGSERVER_H
+#define SCORINGSERVER_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "Vector.h"
+#include "DataView.h"
+#include "BoundedQueue.h"
+#include "LogisticRegression.h"
+#include "ModelFile.h"
+
+/**
+ * @struct ServingOptions
+ * @brief Micro-batching limits for ScoringServer
+ */
+struct ServingOptions {
+    int maxBatchSize = 64;     // Score at most this many requests together
+    int maxWaitMicros = 500;   // Longest a request waits for its batch to fill
+    int queueCapacity = 4096;  // Pending requests before readers block (backpressure)
+    int maxLineBytes = 1 << 20;          // Longer request lines drop the connection
+    int maxPendingReplyBytes = 1 << 20;  // Unsent replies before a client that stopped reading is dropped
+};
+
+/**
+ * @struct ServingStats
+ * @brief Latency and throughput summary of one serving session
+ */
+struct ServingStats {
+    long long requests = 0;     // Rows answered (including malformed ones)
+    long long batches = 0;      // Scoring calls made
+    double seconds = 0.0;       // From the first request to the last reply
+    double p50Micros = 0.0;     // Median request latency (arrival -> reply written)
+    double p99Micros = 0.0;     // 99th percentile latency
+    double maxMicros = 0.0;
+    double throughput = 0.0;    // Requests per second
+    double meanBatchSize = 0.0;
+};
+
+/**
+ * @class ScoringServer
+ * @brief Online scoring over stdin/stdout or a Unix domain socket, with micro-batching
+ *
+ * This class demonstrates:
+ * - Producer/consumer threads around a BoundedQueue (readers -> batcher)
+ * - std::function callbacks for the scoring step, so a trained
+ *   LogisticRegression or a memory-mapped ModelFile can be served
+ * - RAII for sockets (connections close when the last request referring
+ *   to them has been answered)
+ *
+ * Protocol: one request per line, the feature values separated by commas;
+ * the reply is one line with the probability of class 1, or a line
+ * starting with "error:" for malformed input. Replies on each stream come
+ * back in request order.
+ *
+ * Reader threads parse lines and queue them with their arrival time. The
+ * batcher takes the first waiting request, then keeps collecting until the
+ * batch holds maxBatchSize rows or maxWaitMicros have passed since that
+ * first request, scores the batch with one vectorized predictProba call
+ * and writes the replies. Under load batches fill immediately; when idle a
+ * lone request waits at most maxWaitMicros.
+ *
+ * The batcher never blocks on a client. Each socket connection has an
+ * outbox: a batch's replies are appended to it and sent with one
+ * non-blocking send, and whatever the socket does not take is retried
+ * between batches. A client that lets more than maxPendingReplyBytes pile
+ * up, or sends a line longer than maxLineBytes, is disconnected, so one
+ * slow or hostile client costs bounded memory and never delays the
+ * others. In stream mode an over-long line gets an error reply instead
+ * (the input is a single producer, so there is nobody else to protect).
+ */
+class ScoringServer {
+public:
+    using Scorer = std::function<Vector(const DataView&)>;
+
+private:
+    struct Connection;  // One accepted socket (defined in the .cpp)
+
+    // A parsed request waiting for its batch
+    struct Request {
+        std::vector<double> features;
+        std::string error;                        // Non-empty for malformed input
+        std::shared_ptr<Connection> connection;   // Null in stream mode
+        std::chrono::steady_clock::time_point arrival;
+    };
+
+    Scorer scorer;
+    int numFeatures;
+    ServingOptions options;
+    std::atomic<bool> stopping;
+    std::ostream* streamOut;  // Reply stream in stream mode
+    std::vector<std::shared_ptr<Connection>> backlog;  // Connections with unsent replies (batcher only)
+
+    // Batcher loop: runs until the queue is closed and drained
+    ServingStats runBatcher(BoundedQueue<Request>& queue);
+    bool nextRequest(BoundedQueue<Request>& queue, Request& request);
+    void reply(const Request& request, const std::string& line);
+    void flushBacklog();
+    void finishBacklog();
+    Request parseRequest(const std::string& line) const;
+
+public:
+    // Constructors: serve a trained model or a mapped model file
+    ScoringServer(LogisticRegression& model, const ServingOptions& servingOptions = ServingOptions());
+    ScoringServer(const ModelFile& model, const ServingOptions& servingOptions = ServingOptions());
+    ScoringServer(Scorer scoreBatch, int features, const ServingOptions& servingOptions = ServingOptions());
+
+    // Serve lines from in until end of input (or stop()), replying on out
+    ServingStats serveStream(std::istream& in, std::ostream& out);
+
+    // Listen on a Unix domain socket at path until stop(); returns the
+    // session statistics (throws std::runtime_error if the socket cannot be opened)
+    ServingStats serveSocket(const std::string& path);
+
+    // Ask a running serve call to finish; safe to call from a signal handler
+    void stop();
+
+    // Print a stats summary
+    static void displayStats(const ServingStats& stats, std::ostream& os);
+};
+
+#endif // SCORINGSERVER_H
@@ -0,0 +1,87 @@
+#ifndef SOFTMAXREGRESSION_H
+#define SOFTMAXREGRESSION_H
+
+#include <vector>
+#include "Model.h"
+#include "Matrix.h"
+#include "Vector.h"
+#include "DataView.h"
+
+/**
+ * @class SoftmaxRegression
+ * @brief Multinomial (K-class) logistic regression trained by mini-batch SGD
+ *
+ * This class demonstrates:
+ * - Inheritance from Model interface, alongside LogisticRegression
+ * - Batched linear algebra: scoring a block of rows is one GEMM
+ *   Z = X W + 1 b^T against a features x classes weight Matrix
+ * - Numerically stable softmax (subtract the row maximum before exp)
+ *
+ * Mathematical foundation:
+ * - Softmax: p_k = e^(z_k - max z) / Σ_c e^(z_c - max z)
+ * - Cost function: J(W, b) = -1/m * Σ log p_(y_i)
+ * - Gradient: ∇_W J = 1/m * X^T (P - Y), ∇_b J = 1/m * Σ (P - Y)
+ *   where Y is the one-hot label matrix
+ *
+ * Labels are class indices 0 .. K-1 stored as doubles; with numClasses 0
+ * the class count is taken from the largest label at train time. One
+ * model covers all K classes, so a K-class problem costs one training run
+ * instead of K one-vs-rest LogisticRegression runs.
+ */
+class SoftmaxRegression : public Model {
+private:
+    Matrix weights;         // Features x classes (row j holds feature j's class weights)
+    Vector bias;            // One bias per class
+    double learningRate;    // Step size for SGD
+    int epochs;             // Passes over the training rows
+    int batchSize;          // Rows per update
+    int numClasses;         // Configured K; 0 = infer from the labels
+    unsigned long shuffleSeed;  // Seed for the per-epoch row order
+    bool isTrained;         // Training status flag
+
+    // Z[r * K + k] = b_k + x · W[:, k] for count rows of the view, taken from
+    // rows[first + r], or first + r when rows is null
+    void computeScores(const DataView& data, const int* rows, int first, int count, double* Z) const;
+    // One SGD update on the given rows; returns their mean loss before the update
+    double gradientStep(const DataView& data, const int* rows, int count, double rate,
+                        std::vector<double>& Z, std::vector<double>& gradient);
+    int checkLabels(const DataView& data) const;  // Validates labels, returns K
+
+public:
+    // Constructors
+    SoftmaxRegression();
+    SoftmaxRegression(int classes, double lr, int numEpochs);
+
+    // Destructor
+    ~SoftmaxRegression();
+
+    // Implementation of Model interface
+    void train(const Matrix& X, const Vector& y) override;
+    void train(const DataView& data) override;
+    Vector predict(const Matrix& X) override;       // Most probable class per row
+    Vector predict(const DataView& data) override;
+
+    // Additional methods
+    Matrix predictProba(const Matrix& X) const;     // Rows x classes probabilities
+    Matrix predictProba(const DataView& data) const;
+    double meanLoss(const DataView& data) const;    // Cross-entropy with current parameters
+    void displayInfo() const override;
+
+    // Stable in-place softmax of one row of k scores
+    static void softmax(double* z, int k);
+
+    // Getters
+    Matrix getWeights() const;
+    Vector getBias() const;
+    int getNumClasses() const;  // Trained K (configured K before training)
+    int getBatchSize() const;
+    bool getIsTrained() const;
+
+    // Setters
+    void setLearningRate(double lr);
+    void setEpochs(int numEpochs);
+    void setBatchSize(int rows);
+    void setShuffleSeed(unsigned long seed);
+};
+
+#endif // SOFTMAXREGRESSION_H
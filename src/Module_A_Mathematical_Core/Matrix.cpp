@@ -1,6 +1,8 @@
 #include "Matrix.h"
+#include <cmath>
 #include <iostream>
 #include <stdexcept>
+#include <utility>
 
 // Default constructor
 Matrix::Matrix() : Tensor() {}
@@ -11,6 +13,9 @@ Matrix::Matrix(int rows, int cols) : Tensor(rows, cols) {}
 // Copy constructor
 Matrix::Matrix(const Matrix& other) : Tensor(other) {}
 
+// Move constructor
+Matrix::Matrix(Matrix&& other) noexcept : Tensor(std::move(other)) {}
+
 // Destructor
 Matrix::~Matrix() {
     // Base class destructor handles cleanup
@@ -22,6 +27,12 @@ Matrix& Matrix::operator=(const Matrix& other) {
     return *this;
 }
 
+// Move assignment
+Matrix& Matrix::operator=(Matrix&& other) noexcept {
+    Tensor::operator=(std::move(other));
+    return *this;
+}
+
 // Matrix addition - operator overloading
 Matrix Matrix::operator+(const Matrix& other) const {
     if (rows != other.rows || cols != other.cols) {
@@ -97,6 +108,53 @@ const double& Matrix::at(int row, int col) const {
     return data[row][col];
 }
 
+// Cholesky factorization of the lower triangle, then two triangular solves
+bool Matrix::solveCholesky(const Vector& b, Vector& x) const {
+    if (rows != cols || b.getSize() != rows) {
+        throw std::invalid_argument("Cholesky solve needs a square matrix and a matching vector");
+    }
+    
+    int n = rows;
+    Matrix lower(n, n);
+    for (int j = 0; j < n; j++) {
+        double* lj = lower.data[j];
+        double diagonal = data[j][j];
+        for (int k = 0; k < j; k++) {
+            diagonal -= lj[k] * lj[k];
+        }
+        if (!(diagonal > 0.0)) {
+            return false;
+        }
+        lj[j] = std::sqrt(diagonal);
+        for (int i = j + 1; i < n; i++) {
+            const double* li = lower.data[i];
+            double sum = data[i][j];
+            for (int k = 0; k < j; k++) {
+                sum -= li[k] * lj[k];
+            }
+            lower.data[i][j] = sum / lj[j];
+        }
+    }
+    
+    // L z = b, then L^T x = z
+    x = Vector(n);
+    for (int i = 0; i < n; i++) {
+        double sum = b[i];
+        for (int k = 0; k < i; k++) {
+            sum -= lower.data[i][k] * x[k];
+        }
+        x[i] = sum / lower.data[i][i];
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        double sum = x[i];
+        for (int k = i + 1; k < n; k++) {
+            sum -= lower.data[k][i] * x[k];
+        }
+        x[i] = sum / lower.data[i][i];
+    }
+    return true;
+}
+
 // Display method override
 void Matrix::display() const {
     std::cout << "Matrix [" << rows << "x" << cols << "]:" << std::endl;
@@ -0,0 +1,157 @@
+#include "Parallel.h"
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+std::atomic<int> Parallel::threadCount(0);
+
+namespace {
+
+// One forRange call. Blocks are claimed through next, so the caller and any
+// number of pool workers can share the work; the job lives on the caller's
+// stack until done == blocks and no worker still refers to it
+struct Job {
+    const std::function<void(int, int, int)>* body;
+    int begin;
+    int size;
+    int blocks;
+    std::atomic<int> next;
+    std::atomic<int> done;
+    int workers;  // Pool threads inside runBlocks (guarded by the pool mutex)
+
+    Job(const std::function<void(int, int, int)>& work, int first, int count, int numBlocks)
+        : body(&work), begin(first), size(count), blocks(numBlocks), next(0), done(0), workers(0) {}
+
+    // Claim and run blocks until none are left
+    void runBlocks() {
+        for (int b = next++; b < blocks; b = next++) {
+            int blockBegin = begin + static_cast<int>(static_cast<long long>(size) * b / blocks);
+            int blockEnd = begin + static_cast<int>(static_cast<long long>(size) * (b + 1) / blocks);
+            (*body)(b, blockBegin, blockEnd);
+            done++;
+        }
+    }
+};
+
+// Process-wide worker threads, started on first use and grown on demand
+class WorkerPool {
+private:
+    std::mutex mutex;
+    std::condition_variable workAvailable;
+    std::condition_variable jobFinished;
+    std::deque<Job*> jobs;
+    std::vector<std::thread> threads;
+    bool stopping = false;
+
+    void workerLoop() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            workAvailable.wait(lock, [this]() { return stopping || !jobs.empty(); });
+            if (stopping) {
+                return;
+            }
+            Job* job = jobs.front();
+            job->workers++;
+            lock.unlock();
+            job->runBlocks();
+            lock.lock();
+            job->workers--;
+            // Every block is claimed: stop offering the job to other workers
+            auto position = std::find(jobs.begin(), jobs.end(), job);
+            if (position != jobs.end()) {
+                jobs.erase(position);
+            }
+            jobFinished.notify_all();
+        }
+    }
+
+public:
+    ~WorkerPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        workAvailable.notify_all();
+        for (std::thread& thread : threads) {
+            thread.join();
+        }
+    }
+
+    // Share the job with up to helpers pool threads, work on it, and wait
+    void run(Job& job, int helpers) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            while (static_cast<int>(threads.size()) < helpers) {
+                threads.emplace_back(&WorkerPool::workerLoop, this);
+            }
+            jobs.push_back(&job);
+        }
+        for (int h = 0; h < helpers; h++) {
+            workAvailable.notify_one();
+        }
+
+        job.runBlocks();
+
+        std::unique_lock<std::mutex> lock(mutex);
+        auto position = std::find(jobs.begin(), jobs.end(), &job);
+        if (position != jobs.end()) {
+            jobs.erase(position);
+        }
+        jobFinished.wait(lock, [&job]() { return job.done == job.blocks && job.workers == 0; });
+    }
+};
+
+WorkerPool& pool() {
+    static WorkerPool instance;
+    return instance;
+}
+
+} // namespace
+
+// Configured or hardware thread count
+int Parallel::getThreadCount() {
+    int configured = threadCount.load();
+    if (configured > 0) {
+        return configured;
+    }
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? static_cast<int>(hardware) : 1;
+}
+
+void Parallel::setThreadCount(int count) {
+    threadCount.store(std::max(0, count));
+}
+
+// Blocks of at least minGrain items, no more blocks than threads
+int Parallel::blockCount(int size, int minGrain, int maxThreads) {
+    if (size <= 0) {
+        return 0;
+    }
+    int threads = getThreadCount();
+    if (maxThreads > 0) {
+        threads = std::min(threads, maxThreads);
+    }
+    int byGrain = size / std::max(1, minGrain);
+    return std::max(1, std::min(threads, byGrain));
+}
+
+// Fork-join over contiguous blocks on the persistent pool
+void Parallel::forRange(int begin, int end, int minGrain,
+                        const std::function<void(int block, int blockBegin, int blockEnd)>& body,
+                        int maxThreads) {
+    int size = end - begin;
+    int blocks = blockCount(size, minGrain, maxThreads);
+    if (blocks == 0) {
+        return;
+    }
+    if (blocks == 1) {
+        body(0, begin, end);
+        return;
+    }
+
+    Job job(body, begin, size, blocks);
+    pool().run(job, blocks - 1);
+}
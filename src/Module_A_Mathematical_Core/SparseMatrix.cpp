@@ -0,0 +1,107 @@
+#include "SparseMatrix.h"
+#include <algorithm>
+#include <stdexcept>
+
+// Default constructor
+SparseMatrix::SparseMatrix() : cols(0), rowPtr(1, 0) {}
+
+// Empty matrix of the given width
+SparseMatrix::SparseMatrix(int numCols) : cols(numCols), rowPtr(1, 0) {
+    if (numCols < 0) {
+        throw std::invalid_argument("Number of columns must be non-negative");
+    }
+}
+
+// Destructor
+SparseMatrix::~SparseMatrix() {}
+
+// Sort by column, merge duplicates, drop zeros, then append
+void SparseMatrix::appendRow(std::vector<std::pair<int, double>>& entries) {
+    std::sort(entries.begin(), entries.end(),
+              [](const std::pair<int, double>& a, const std::pair<int, double>& b) {
+                  return a.first < b.first;
+              });
+    // Sorted, so the ends bound every column; checked before anything is
+    // appended, so a rejected row leaves the matrix unchanged
+    if (!entries.empty() && (entries.front().first < 0 || entries.back().first >= cols)) {
+        throw std::out_of_range("Sparse column index out of range");
+    }
+
+    size_t i = 0;
+    while (i < entries.size()) {
+        int col = entries[i].first;
+        double sum = 0.0;
+        while (i < entries.size() && entries[i].first == col) {
+            sum += entries[i].second;
+            i++;
+        }
+        if (sum != 0.0) {
+            indices.push_back(col);
+            values.push_back(sum);
+        }
+    }
+    rowPtr.push_back(static_cast<long long>(indices.size()));
+}
+
+// Pre-size the arrays when the final shape is roughly known
+void SparseMatrix::reserve(int rows, long long nonZeros) {
+    rowPtr.reserve(static_cast<size_t>(rows) + 1);
+    indices.reserve(static_cast<size_t>(nonZeros));
+    values.reserve(static_cast<size_t>(nonZeros));
+}
+
+// Remove all rows, keep the width
+void SparseMatrix::clear() {
+    rowPtr.assign(1, 0);
+    indices.clear();
+    values.clear();
+}
+
+// Row access
+long long SparseMatrix::rowStart(int row) const {
+    return rowPtr[row];
+}
+
+long long SparseMatrix::rowEnd(int row) const {
+    return rowPtr[row + 1];
+}
+
+// Dot product of one row with a dense vector of length getCols()
+double SparseMatrix::dotRow(int row, const double* dense) const {
+    double sum = 0.0;
+    for (long long k = rowPtr[row]; k < rowPtr[row + 1]; k++) {
+        sum += values[k] * dense[indices[k]];
+    }
+    return sum;
+}
+
+// Getters
+int SparseMatrix::getRows() const {
+    return static_cast<int>(rowPtr.size()) - 1;
+}
+
+int SparseMatrix::getCols() const {
+    return cols;
+}
+
+long long SparseMatrix::getNonZeros() const {
+    return static_cast<long long>(indices.size());
+}
+
+const int* SparseMatrix::getIndices() const {
+    return indices.data();
+}
+
+const double* SparseMatrix::getValues() const {
+    return values.data();
+}
+
+double SparseMatrix::getValue(int row, int col) const {
+    if (row < 0 || row >= getRows() || col < 0 || col >= cols) {
+        throw std::out_of_range("Sparse matrix index out of range");
+    }
+    const int* first = indices.data() + rowPtr[row];
+    const int* last = indices.data() + rowPtr[row + 1];
+    const int* found = std::lower_bound(first, last, col);
+    return (found != last && *found == col) ? values[found - indices.data()] : 0.0;
+}
@@ -1,27 +1,33 @@
 #include "Tensor.h"
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
 
 // Default constructor
-Tensor::Tensor() : data(nullptr), rows(0), cols(0) {}
+Tensor::Tensor() : data(nullptr), storage(nullptr), rows(0), cols(0) {}
 
 // Parameterized constructor
-Tensor::Tensor(int r, int c) : rows(r), cols(c) {
+Tensor::Tensor(int r, int c) : data(nullptr), storage(nullptr), rows(r), cols(c) {
     allocateMemory(r, c);
     // Initialize to zeros
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < cols; j++) {
-            data[i][j] = 0.0;
-        }
-    }
+    std::fill(storage, storage + static_cast<size_t>(rows) * cols, 0.0);
 }
 
 // Copy constructor - demonstrates deep copy
-Tensor::Tensor(const Tensor& other) : rows(other.rows), cols(other.cols) {
+Tensor::Tensor(const Tensor& other) : data(nullptr), storage(nullptr), rows(other.rows), cols(other.cols) {
     allocateMemory(rows, cols);
     copyData(other);
 }
 
+// Move constructor - takes over the other tensor's buffer
+Tensor::Tensor(Tensor&& other) noexcept
+    : data(other.data), storage(other.storage), rows(other.rows), cols(other.cols) {
+    other.data = nullptr;
+    other.storage = nullptr;
+    other.rows = 0;
+    other.cols = 0;
+}
+
 // Destructor
 Tensor::~Tensor() {
     deallocateMemory();
@@ -44,32 +50,44 @@ Tensor& Tensor::operator=(const Tensor& other) {
     return *this;
 }
 
-// Protected helper: Allocate memory
+// Move assignment - releases own buffer and takes over the other's
+Tensor& Tensor::operator=(Tensor&& other) noexcept {
+    if (this != &other) {
+        deallocateMemory();
+        
+        data = other.data;
+        storage = other.storage;
+        rows = other.rows;
+        cols = other.cols;
+        
+        other.data = nullptr;
+        other.storage = nullptr;
+        other.rows = 0;
+        other.cols = 0;
+    }
+    return *this;
+}
+
+// Protected helper: Allocate memory (one block, plus row pointers into it)
 void Tensor::allocateMemory(int r, int c) {
+    storage = new double[static_cast<size_t>(r) * c];
     data = new double*[r];
     for (int i = 0; i < r; i++) {
-        data[i] = new double[c];
+        data[i] = storage + static_cast<size_t>(i) * c;
     }
 }
 
 // Protected helper: Deallocate memory
 void Tensor::deallocateMemory() {
-    if (data != nullptr) {
-        for (int i = 0; i < rows; i++) {
-            delete[] data[i];
-        }
-        delete[] data;
-        data = nullptr;
-    }
+    delete[] storage;
+    delete[] data;
+    storage = nullptr;
+    data = nullptr;
 }
 
 // Protected helper: Copy data from another tensor
 void Tensor::copyData(const Tensor& other) {
-    for (int i = 0; i < rows; i++) {
-        for (int j = 0; j < cols; j++) {
-            data[i][j] = other.data[i][j];
-        }
-    }
+    std::copy(other.storage, other.storage + static_cast<size_t>(rows) * cols, storage);
 }
 
 // Getters
@@ -88,6 +106,24 @@ double Tensor::getValue(int row, int col) const {
     return data[row][col];
 }
 
+// Raw row access - no bounds checking, callers iterate within getRows()/getCols()
+double* Tensor::rowData(int row) {
+    return data[row];
+}
+
+const double* Tensor::rowData(int row) const {
+    return data[row];
+}
+
+// Contiguous buffer access
+double* Tensor::rawData() {
+    return storage;
+}
+
+const double* Tensor::rawData() const {
+    return storage;
+}
+
 // Setters
 void Tensor::setValue(int row, int col, double value) {
     if (row < 0 || row >= rows || col < 0 || col >= cols) {
@@ -2,6 +2,7 @@
 #include <iostream>
 #include <stdexcept>
 #include <algorithm>
+#include <utility>
 
 // Default constructor
 Vector::Vector() : Tensor(), size(0) {}
@@ -19,6 +20,11 @@ Vector::Vector(int s, double defaultValue) : Tensor(s, 1), size(s) {
 // Copy constructor
 Vector::Vector(const Vector& other) : Tensor(other), size(other.size) {}
 
+// Move constructor
+Vector::Vector(Vector&& other) noexcept : Tensor(std::move(other)), size(other.size) {
+    other.size = 0;
+}
+
 // Destructor
 Vector::~Vector() {
     // Base class destructor handles cleanup
@@ -33,6 +39,16 @@ Vector& Vector::operator=(const Vector& other) {
     return *this;
 }
 
+// Move assignment
+Vector& Vector::operator=(Vector&& other) noexcept {
+    if (this != &other) {
+        size = other.size;
+        Tensor::operator=(std::move(other));
+        other.size = 0;
+    }
+    return *this;
+}
+
 // Get size
 int Vector::getSize() const {
     return size;
@@ -0,0 +1,193 @@
+#include "VectorMath.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+std::atomic<bool> VectorMath::fastMode(false);
+
+namespace {
+const double LOG2E = 1.4426950408889634;
+const double LN2_HI = 0.693147180369123816490;    // High bits of ln 2 (exact product with k)
+const double LN2_LO = 1.90821492927058770002e-10; // ln 2 - LN2_HI
+const double EXP_MIN = -708.0;
+const double EXP_MAX = 709.0;
+const double SQRT2 = 1.4142135623730951;
+const double ROUNDER = 6755399441055744.0;        // 1.5 * 2^52: adding it rounds to an integer
+const double TWO52 = 4503599627370496.0;          // 2^52
+
+// Bit casts that the vectorizer understands
+inline double fromBits(uint64_t bits) {
+    double value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+inline uint64_t toBits(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// e^x = 2^k * e^r with |r| <= ln2 / 2; Taylor polynomial in r
+template <bool FAST>
+inline double expKernel(double x) {
+    x = std::min(std::max(x, EXP_MIN), EXP_MAX);
+    // After adding ROUNDER the low mantissa bits hold k = round(x / ln2)
+    double shifted = x * LOG2E + ROUNDER;
+    double kd = shifted - ROUNDER;
+    double r = (x - kd * LN2_HI) - kd * LN2_LO;
+    double p;
+    if (FAST) {
+        // Degree 6: truncation error |r|^7 / 7! < 2e-7 relative
+        p = 1.0 + r * (1.0 + r * (1.0 / 2 + r * (1.0 / 6 + r * (1.0 / 24 + r * (1.0 / 120 + r * (1.0 / 720))))));
+    } else {
+        // Degree 13: truncation error below 1e-17 relative
+        p = 1.0 / 6227020800.0;
+        p = 1.0 / 479001600.0 + r * p;
+        p = 1.0 / 39916800.0 + r * p;
+        p = 1.0 / 3628800.0 + r * p;
+        p = 1.0 / 362880.0 + r * p;
+        p = 1.0 / 40320.0 + r * p;
+        p = 1.0 / 5040.0 + r * p;
+        p = 1.0 / 720.0 + r * p;
+        p = 1.0 / 120.0 + r * p;
+        p = 1.0 / 24.0 + r * p;
+        p = 1.0 / 6.0 + r * p;
+        p = 0.5 + r * p;
+        p = 1.0 + r * p;
+        p = 1.0 + r * p;
+    }
+    // 2^k built from k's bits with integer adds/shifts only (no int<->double
+    // conversion, which SSE2/AVX2 cannot do on 64-bit lanes)
+    return p * fromBits((toBits(shifted) + 1023) << 52);
+}
+
+// log x = e ln2 + 2 atanh(f), x = m 2^e, m in [sqrt(1/2), sqrt(2)), f = (m-1)/(m+1)
+template <bool FAST>
+inline double logKernel(double x) {
+    uint64_t bits = toBits(x);
+    // Biased exponent as a double via the 2^52 trick, then unbiased
+    double ed = fromBits(0x4330000000000000ULL | ((bits >> 52) & 0x7ff)) - (TWO52 + 1023.0);
+    double m = fromBits((bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);
+    bool high = m > SQRT2;
+    m = high ? m * 0.5 : m;
+    ed = high ? ed + 1.0 : ed;
+
+    double f = (m - 1.0) / (m + 1.0);
+    double f2 = f * f;
+    double s;
+    if (FAST) {
+        // |f| <= 0.172: f^9 / 9 term below 2e-8
+        s = 1.0 + f2 * (1.0 / 3 + f2 * (1.0 / 5 + f2 * (1.0 / 7)));
+    } else {
+        s = 1.0 / 23;
+        s = 1.0 / 21 + f2 * s;
+        s = 1.0 / 19 + f2 * s;
+        s = 1.0 / 17 + f2 * s;
+        s = 1.0 / 15 + f2 * s;
+        s = 1.0 / 13 + f2 * s;
+        s = 1.0 / 11 + f2 * s;
+        s = 1.0 / 9 + f2 * s;
+        s = 1.0 / 7 + f2 * s;
+        s = 1.0 / 5 + f2 * s;
+        s = 1.0 / 3 + f2 * s;
+        s = 1.0 + f2 * s;
+    }
+    double result = ed * LN2_HI + (2.0 * f * s + ed * LN2_LO);
+
+    // Special inputs as selects so the loop stays branch-free
+    const double inf = std::numeric_limits<double>::infinity();
+    result = (x == 0.0) ? -inf : result;
+    result = (x < 0.0 || x != x) ? std::numeric_limits<double>::quiet_NaN() : result;
+    result = (x == inf) ? inf : result;
+    return result;
+}
+
+// log(1 + x) with the rounding of 1 + x corrected to first order
+template <bool FAST>
+inline double log1pKernel(double x) {
+    double u = 1.0 + x;
+    double correction = (u == 1.0) ? x : (x - (u - 1.0)) / u;
+    double base = logKernel<FAST>(u);
+    return (u == 1.0) ? x : base + correction;
+}
+
+template <bool FAST>
+void expLoop(const double* in, double* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = expKernel<FAST>(in[i]);
+    }
+}
+
+template <bool FAST>
+void sigmoidLoop(const double* in, double* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = 1.0 / (1.0 + expKernel<FAST>(-in[i]));
+    }
+}
+
+template <bool FAST>
+void logLoop(const double* in, double* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = logKernel<FAST>(in[i]);
+    }
+}
+
+template <bool FAST>
+void log1pLoop(const double* in, double* out, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        out[i] = log1pKernel<FAST>(in[i]);
+    }
+}
+
+// Apply an array kernel to a whole vector
+Vector mapVector(const Vector& v, void (*kernel)(const double*, double*, size_t)) {
+    Vector result(v.getSize());
+    kernel(v.rawData(), result.rawData(), static_cast<size_t>(v.getSize()));
+    return result;
+}
+}
+
+// Mode
+bool VectorMath::getFastMode() {
+    return fastMode.load();
+}
+
+void VectorMath::setFastMode(bool enabled) {
+    fastMode.store(enabled);
+}
+
+// Array kernels
+void VectorMath::exp(const double* in, double* out, size_t n) {
+    fastMode.load() ? expLoop<true>(in, out, n) : expLoop<false>(in, out, n);
+}
+
+void VectorMath::sigmoid(const double* in, double* out, size_t n) {
+    fastMode.load() ? sigmoidLoop<true>(in, out, n) : sigmoidLoop<false>(in, out, n);
+}
+
+void VectorMath::log(const double* in, double* out, size_t n) {
+    fastMode.load() ? logLoop<true>(in, out, n) : logLoop<false>(in, out, n);
+}
+
+void VectorMath::log1p(const double* in, double* out, size_t n) {
+    fastMode.load() ? log1pLoop<true>(in, out, n) : log1pLoop<false>(in, out, n);
+}
+
+// Vector conveniences
+Vector VectorMath::exp(const Vector& v) {
+    return mapVector(v, &VectorMath::exp);
+}
+
+Vector VectorMath::sigmoid(const Vector& v) {
+    return mapVector(v, &VectorMath::sigmoid);
+}
+
+Vector VectorMath::log(const Vector& v) {
+    return mapVector(v, &VectorMath::log);
+}
+
+Vector VectorMath::log1p(const Vector& v) {
+    return mapVector(v, &VectorMath::log1p);
+}
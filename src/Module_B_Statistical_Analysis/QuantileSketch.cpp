@@ -0,0 +1,127 @@
+#include "QuantileSketch.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+// Constructor
+QuantileSketch::QuantileSketch(double quantile) : p(quantile) {
+    if (quantile < 0.0 || quantile > 1.0) {
+        throw std::invalid_argument("Quantile must be in [0, 1]");
+    }
+    reset();
+}
+
+// Forget everything seen so far
+void QuantileSketch::reset() {
+    count = 0;
+    for (int i = 0; i < 5; i++) {
+        heights[i] = 0.0;
+        positions[i] = i + 1;
+    }
+    desired[0] = 1.0;
+    desired[1] = 1.0 + 2.0 * p;
+    desired[2] = 1.0 + 4.0 * p;
+    desired[3] = 3.0 + 2.0 * p;
+    desired[4] = 5.0;
+    increments[0] = 0.0;
+    increments[1] = p / 2.0;
+    increments[2] = p;
+    increments[3] = (1.0 + p) / 2.0;
+    increments[4] = 1.0;
+}
+
+// Piecewise-parabolic prediction for marker i moved by d (+1 or -1)
+double QuantileSketch::parabolic(int i, double d) const {
+    double left = positions[i] - positions[i - 1];
+    double right = positions[i + 1] - positions[i];
+    double span = positions[i + 1] - positions[i - 1];
+    return heights[i] + d / span *
+        ((left + d) * (heights[i + 1] - heights[i]) / right +
+         (right - d) * (heights[i] - heights[i - 1]) / left);
+}
+
+// Linear fallback when the parabola would break marker ordering
+double QuantileSketch::linear(int i, int d) const {
+    return heights[i] + d * (heights[i + d] - heights[i]) / (positions[i + d] - positions[i]);
+}
+
+// Feed one observation
+void QuantileSketch::add(double x) {
+    if (count < 5) {
+        heights[count++] = x;
+        if (count == 5) {
+            std::sort(heights, heights + 5);
+        }
+        return;
+    }
+    count++;
+
+    // Find the cell containing x, stretching the extremes if needed
+    int k;
+    if (x < heights[0]) {
+        heights[0] = x;
+        k = 0;
+    } else if (x >= heights[4]) {
+        heights[4] = std::max(heights[4], x);
+        k = 3;
+    } else {
+        k = 0;
+        while (k < 3 && x >= heights[k + 1]) {
+            k++;
+        }
+    }
+
+    for (int i = k + 1; i < 5; i++) {
+        positions[i] += 1.0;
+    }
+    for (int i = 0; i < 5; i++) {
+        desired[i] += increments[i];
+    }
+
+    // Move the three inner markers toward their desired positions
+    for (int i = 1; i <= 3; i++) {
+        double gap = desired[i] - positions[i];
+        if ((gap >= 1.0 && positions[i + 1] - positions[i] > 1.0) ||
+            (gap <= -1.0 && positions[i - 1] - positions[i] < -1.0)) {
+            int d = (gap > 0) ? 1 : -1;
+            double candidate = parabolic(i, d);
+            if (heights[i - 1] < candidate && candidate < heights[i + 1]) {
+                heights[i] = candidate;
+            } else {
+                heights[i] = linear(i, d);
+            }
+            positions[i] += d;
+        }
+    }
+}
+
+// Middle marker, or the exact quantile of the first few values
+double QuantileSketch::getEstimate() const {
+    if (count == 0) {
+        return 0.0;
+    }
+    if (count < 5) {
+        int seen = static_cast<int>(count);
+        // Unused slots sort to the end, so the whole array can be sorted
+        std::array<double, 5> sorted;
+        sorted.fill(std::numeric_limits<double>::infinity());
+        std::copy(heights, heights + seen, sorted.begin());
+        std::sort(sorted.begin(), sorted.end());
+        double rank = p * (seen - 1);
+        int lower = static_cast<int>(std::floor(rank));
+        int upper = std::min(lower + 1, seen - 1);
+        return sorted[lower] + (rank - lower) * (sorted[upper] - sorted[lower]);
+    }
+    return heights[2];
+}
+
+// Getters
+double QuantileSketch::getQuantile() const {
+    return p;
+}
+
+long long QuantileSketch::getCount() const {
+    return count;
+}
@@ -0,0 +1,120 @@
+#include "AffineScaler.h"
+#include "Parallel.h"
+#include <iostream>
+#include <stdexcept>
+
+// Constructor
+AffineScaler::AffineScaler() : isFitted(false), numFeatures(0) {}
+
+// Destructor
+AffineScaler::~AffineScaler() {}
+
+// Learn parameters from scratch
+void AffineScaler::fit(const Matrix& data) {
+    fit(DataView(data));
+}
+
+void AffineScaler::fit(const DataView& data) {
+    if (data.getRows() == 0 || data.getCols() == 0) {
+        throw std::invalid_argument("Cannot fit scaler on empty data");
+    }
+
+    resetStatistics(data.getCols());
+    numFeatures = data.getCols();
+    accumulate(data);
+    computeAffine();
+    isFitted = true;
+    std::cout << getName() << " fitted successfully" << std::endl;
+}
+
+// Fold one more chunk into the parameters learned so far
+void AffineScaler::partialFit(const Matrix& chunk) {
+    partialFit(DataView(chunk));
+}
+
+void AffineScaler::partialFit(const DataView& chunk) {
+    if (chunk.getRows() == 0) {
+        return;
+    }
+    if (numFeatures == 0) {
+        resetStatistics(chunk.getCols());
+        numFeatures = chunk.getCols();
+    } else if (chunk.getCols() != numFeatures) {
+        throw std::invalid_argument("Number of features must match previous chunks");
+    }
+
+    accumulate(chunk);
+    computeAffine();
+    isFitted = true;
+}
+
+// Transform method - X * scale + offset into a new matrix
+Matrix AffineScaler::transform(const Matrix& data) {
+    return transform(DataView(data));
+}
+
+// Scale the rows selected by a view into a new matrix
+Matrix AffineScaler::transform(const DataView& data) {
+    checkFitted(data.getCols());
+
+    int numSamples = data.getRows();
+    int cols = data.getCols();
+    Matrix scaled(numSamples, cols);
+    const double* s = scale.rawData();
+    const double* o = offset.rawData();
+
+    Parallel::forRange(0, numSamples, Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        for (int row = begin; row < end; row++) {
+            const double* src = data.row(row);
+            double* dst = scaled.rowData(row);
+            for (int col = 0; col < cols; col++) {
+                dst[col] = src[col] * s[col] + o[col];
+            }
+        }
+    });
+
+    std::cout << "Data transformed successfully" << std::endl;
+    return scaled;
+}
+
+// Scale a matrix in place: no output allocation, one read and one write per element.
+// Silent, since pipelines call it once per row block
+void AffineScaler::transformInPlace(Matrix& data) {
+    checkFitted(data.getCols());
+
+    int cols = data.getCols();
+    const double* s = scale.rawData();
+    const double* o = offset.rawData();
+
+    Parallel::forRange(0, data.getRows(), Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        for (int row = begin; row < end; row++) {
+            double* x = data.rowData(row);
+            for (int col = 0; col < cols; col++) {
+                x[col] = x[col] * s[col] + o[col];
+            }
+        }
+    });
+}
+
+// Shared precondition for the transform methods
+void AffineScaler::checkFitted(int features) const {
+    if (!isFitted) {
+        throw std::runtime_error("Scaler must be fitted before transform");
+    }
+    if (features != scale.getSize()) {
+        throw std::invalid_argument("Number of features must match fitted data");
+    }
+}
+
+// Getters
+Vector AffineScaler::getScale() const {
+    return scale;
+}
+
+Vector AffineScaler::getOffset() const {
+    return offset;
+}
+
+bool AffineScaler::getIsFitted() const {
+    return isFitted;
+}
@@ -0,0 +1,186 @@
+#include "BatchPrefetcher.h"
+#include "Dataset.h"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+// Constructor - nothing is read until start()
+BatchPrefetcher::BatchPrefetcher(const std::string& path, int rowsPerBatch, int capacity, int passes)
+    : filepath(path), batchSize(rowsPerBatch), numPasses(passes), numColumns(0),
+      lineBlocks(static_cast<size_t>(std::max(1, capacity))),
+      readyBatches(static_cast<size_t>(std::max(1, capacity))),
+      freeBatches(static_cast<size_t>(std::max(1, capacity)) + 2),
+      stopping(false), started(false) {
+    if (rowsPerBatch < 1 || passes < 1) {
+        throw std::invalid_argument("Batch size and number of passes must be positive");
+    }
+    // One spare buffer per ready slot plus one being filled; the consumer
+    // brings its own, which is why freeBatches holds capacity + 2
+    for (int i = 0; i <= std::max(1, capacity); i++) {
+        freeBatches.push(DataBatch());
+    }
+}
+
+// Destructor
+BatchPrefetcher::~BatchPrefetcher() {
+    stop();
+}
+
+// Read the header and launch the I/O and parse threads
+bool BatchPrefetcher::start() {
+    if (started) {
+        return true;
+    }
+
+    file.open(filepath);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open file " << filepath << std::endl;
+        return false;
+    }
+
+    std::string line;
+    std::vector<std::string> header;
+    if (std::getline(file, line)) {
+        std::stringstream ss(Dataset::trimLine(line));
+        std::string name;
+        while (std::getline(ss, name, ',')) {
+            header.push_back(name);
+        }
+    }
+    if (header.size() < 2) {
+        std::cerr << "Error: " << filepath << " needs a header with at least one feature and a label" << std::endl;
+        file.close();
+        return false;
+    }
+
+    numColumns = static_cast<int>(header.size());
+    slotOf.resize(numColumns);
+    for (int j = 0; j < numColumns; j++) {
+        slotOf[j] = j;  // Features in file order, label last
+    }
+
+    started = true;
+    ioThread = std::thread(&BatchPrefetcher::readLoop, this);
+    parseThread = std::thread(&BatchPrefetcher::parseLoop, this);
+    return true;
+}
+
+// I/O thread: read blocks of raw lines, rewinding for every pass
+void BatchPrefetcher::readLoop() {
+    for (int pass = 0; pass < numPasses && !stopping; pass++) {
+        if (pass > 0) {
+            file.clear();
+            file.seekg(0);
+            std::string header;
+            std::getline(file, header);
+        }
+
+        std::vector<std::string> block;
+        block.reserve(batchSize);
+        std::string line;
+        while (!stopping && std::getline(file, line)) {
+            if (Dataset::trimLine(line).empty()) {
+                continue;
+            }
+            block.push_back(std::move(line));
+            if (static_cast<int>(block.size()) == batchSize) {
+                if (!lineBlocks.push(std::move(block))) return;
+                block.clear();
+                block.reserve(batchSize);
+            }
+        }
+        if (!block.empty() && !lineBlocks.push(std::move(block))) return;
+
+        // An empty block marks the end of a pass
+        if (!lineBlocks.push(std::vector<std::string>())) return;
+    }
+    lineBlocks.close();
+}
+
+// Parse thread: turn line blocks into batches, reusing recycled buffers
+void BatchPrefetcher::parseLoop() {
+    int numFeatures = numColumns - 1;
+    int pass = 0;
+    long long rowInPass = 0;
+    std::vector<double> values;
+    std::vector<double> row(numColumns);
+    std::vector<std::string> block;
+
+    while (lineBlocks.pop(block)) {
+        if (block.empty()) {
+            pass++;
+            rowInPass = 0;
+            continue;
+        }
+
+        values.clear();
+        for (const std::string& line : block) {
+            if (Dataset::parseRow(line, slotOf, row.data())) {
+                values.insert(values.end(), row.begin(), row.end());
+            }
+        }
+        int rows = static_cast<int>(values.size() / numColumns);
+        long long firstRow = rowInPass;
+        rowInPass += static_cast<long long>(block.size());
+        if (rows == 0) {
+            continue;
+        }
+
+        DataBatch batch;
+        if (!freeBatches.pop(batch)) break;
+        if (batch.features.getRows() != rows || batch.features.getCols() != numFeatures) {
+            batch.features = Matrix(rows, numFeatures);
+            batch.labels = Vector(rows);
+        }
+        for (int i = 0; i < rows; i++) {
+            const double* src = values.data() + static_cast<size_t>(i) * numColumns;
+            std::copy(src, src + numFeatures, batch.features.rowData(i));
+            batch.labels.rowData(i)[0] = src[numFeatures];
+        }
+        batch.pass = pass;
+        batch.firstRow = firstRow;
+
+        if (!readyBatches.push(std::move(batch))) break;
+    }
+    readyBatches.close();
+}
+
+// Hand the next batch to the consumer and recycle the one it gives back
+bool BatchPrefetcher::next(DataBatch& batch) {
+    if (!started) {
+        return false;
+    }
+    DataBatch incoming;
+    if (!readyBatches.pop(incoming)) {
+        return false;
+    }
+    std::swap(batch, incoming);
+    freeBatches.push(std::move(incoming));
+    return true;
+}
+
+// Cancel and join
+void BatchPrefetcher::stop() {
+    stopping = true;
+    lineBlocks.close();
+    readyBatches.close();
+    freeBatches.close();
+    if (ioThread.joinable()) ioThread.join();
+    if (parseThread.joinable()) parseThread.join();
+    if (file.is_open()) file.close();
+}
+
+// Getters
+int BatchPrefetcher::getNumFeatures() const {
+    return (numColumns > 0) ? numColumns - 1 : 0;
+}
+
+int BatchPrefetcher::getBatchSize() const {
+    return batchSize;
+}
+
+int BatchPrefetcher::getNumPasses() const {
+    return numPasses;
+}
@@ -0,0 +1,88 @@
+#include "CSVLoadOptions.h"
+#include <stdexcept>
+
+// Constructor - every row, every column
+CSVLoadOptions::CSVLoadOptions()
+    : sampling(ALL_ROWS), everyK(1), probability(1.0), reservoirSize(0), seed(0) {}
+
+// Keep every k-th row
+CSVLoadOptions CSVLoadOptions::everyKth(int k) {
+    if (k < 1) {
+        throw std::invalid_argument("Sampling stride must be at least 1");
+    }
+    CSVLoadOptions options;
+    options.sampling = EVERY_KTH;
+    options.everyK = k;
+    return options;
+}
+
+// Keep each row with probability p
+CSVLoadOptions CSVLoadOptions::bernoulli(double p, unsigned long seed) {
+    if (p <= 0.0 || p > 1.0) {
+        throw std::invalid_argument("Sampling probability must be in (0, 1]");
+    }
+    CSVLoadOptions options;
+    options.sampling = BERNOULLI;
+    options.probability = p;
+    options.seed = seed;
+    return options;
+}
+
+// Keep a uniform sample of n rows
+CSVLoadOptions CSVLoadOptions::reservoir(int n, unsigned long seed) {
+    if (n < 1) {
+        throw std::invalid_argument("Reservoir size must be at least 1");
+    }
+    CSVLoadOptions options;
+    options.sampling = RESERVOIR;
+    options.reservoirSize = n;
+    options.seed = seed;
+    return options;
+}
+
+bool CSVLoadOptions::isFullLoad() const {
+    return sampling == ALL_ROWS && columnNames.empty() && columnIndices.empty();
+}
+
+// Resolve names and positions against the header; the last header entry is the label
+std::vector<int> CSVLoadOptions::resolveColumns(const std::vector<std::string>& header) const {
+    int numFeatures = static_cast<int>(header.size()) - 1;
+    std::vector<int> selected;
+
+    if (columnNames.empty() && columnIndices.empty()) {
+        for (int j = 0; j < numFeatures; j++) {
+            selected.push_back(j);
+        }
+        return selected;
+    }
+
+    for (int index : columnIndices) {
+        if (index < 0 || index >= numFeatures) {
+            throw std::invalid_argument("Selected column index " + std::to_string(index) + " is not a feature column");
+        }
+        selected.push_back(index);
+    }
+
+    for (const std::string& name : columnNames) {
+        int found = -1;
+        for (int j = 0; j < numFeatures; j++) {
+            if (header[j] == name) {
+                found = j;
+                break;
+            }
+        }
+        if (found < 0) {
+            throw std::invalid_argument("Selected column '" + name + "' is not a feature column");
+        }
+        selected.push_back(found);
+    }
+
+    std::vector<bool> seen(numFeatures, false);
+    for (int index : selected) {
+        if (seen[index]) {
+            throw std::invalid_argument("Column " + header[index] + " selected more than once");
+        }
+        seen[index] = true;
+    }
+    return selected;
+}
@@ -0,0 +1,251 @@
+#include "ColumnCodec.h"
+#include <cmath>
+#include <cstring>
+#include <unordered_map>
+
+namespace {
+
+const size_t MAX_DICTIONARY_SIZE = 4096;
+const int MAX_PACKED_BITS = 32;
+const double MAX_EXACT_INTEGER = 9007199254740992.0;  // 2^53
+const size_t PACK_PADDING = 8;
+
+uint64_t bitsOf(double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+// Number of bits needed to store values in [0, maxValue]
+int bitsFor(uint64_t maxValue) {
+    int bits = 0;
+    while (bits < 64 && (maxValue >> bits) != 0) {
+        bits++;
+    }
+    return bits;
+}
+
+size_t packedBytes(size_t count, int bitWidth) {
+    return (count * static_cast<size_t>(bitWidth) + 7) / 8 + PACK_PADDING;
+}
+
+// True if the value is an integer that a double and an int64 both hold exactly
+// (-0.0 is excluded so decoding reproduces the exact bit pattern)
+bool isExactInteger(double value) {
+    return std::isfinite(value) && value == std::trunc(value) &&
+           std::fabs(value) <= MAX_EXACT_INTEGER && !(value == 0.0 && std::signbit(value));
+}
+
+// LSB-first bit packing; out must hold packedBytes(count, bitWidth) zeroed bytes
+void pack(const uint64_t* values, size_t count, int bitWidth, unsigned char* out) {
+    for (size_t i = 0; i < count; i++) {
+        size_t bit = i * static_cast<size_t>(bitWidth);
+        uint64_t word;
+        std::memcpy(&word, out + bit / 8, sizeof(word));
+        word |= values[i] << (bit % 8);
+        std::memcpy(out + bit / 8, &word, sizeof(word));
+    }
+}
+
+// Branch-free unpack of value i: one unaligned 64-bit load, shift and mask
+inline uint64_t unpack(const unsigned char* in, size_t i, int bitWidth, uint64_t mask) {
+    size_t bit = i * static_cast<size_t>(bitWidth);
+    uint64_t word;
+    std::memcpy(&word, in + bit / 8, sizeof(word));
+    return (word >> (bit % 8)) & mask;
+}
+
+uint64_t maskFor(int bitWidth) {
+    return (bitWidth >= 64) ? ~0ULL : ((1ULL << bitWidth) - 1);
+}
+
+} // namespace
+
+// Size every applicable codec and encode with the smallest one
+void ColumnCodec::encode(const double* values, size_t count,
+                         ColumnEncoding& encoding, std::vector<unsigned char>& bytes) {
+    std::memset(&encoding, 0, sizeof(encoding));
+
+    // Gather the statistics every codec needs in one pass
+    bool floatExact = true;
+    bool integral = true;
+    double minValue = 0.0;
+    double maxValue = 0.0;
+    std::unordered_map<uint64_t, uint32_t> dictionary;
+    bool dictionaryFits = true;
+
+    for (size_t i = 0; i < count; i++) {
+        double v = values[i];
+        if (floatExact) {
+            double roundTrip = static_cast<double>(static_cast<float>(v));
+            floatExact = bitsOf(roundTrip) == bitsOf(v);
+        }
+        if (integral) {
+            integral = isExactInteger(v);
+            if (i == 0 || v < minValue) minValue = v;
+            if (i == 0 || v > maxValue) maxValue = v;
+        }
+        if (dictionaryFits) {
+            dictionary.emplace(bitsOf(v), static_cast<uint32_t>(dictionary.size()));
+            dictionaryFits = dictionary.size() <= MAX_DICTIONARY_SIZE;
+        }
+    }
+
+    int bestCodec = RAW;
+    size_t bestSize = count * sizeof(double);
+
+    if (floatExact && count * sizeof(float) < bestSize) {
+        bestCodec = FLOAT32;
+        bestSize = count * sizeof(float);
+    }
+
+    int dictionaryBits = bitsFor(dictionary.empty() ? 0 : dictionary.size() - 1);
+    if (dictionaryFits) {
+        size_t size = dictionary.size() * sizeof(double) + packedBytes(count, dictionaryBits);
+        if (size < bestSize) {
+            bestCodec = DICTIONARY;
+            bestSize = size;
+        }
+    }
+
+    int forBits = 0;
+    int deltaBits = 0;
+    int64_t minDelta = 0;
+    if (integral && count > 0) {
+        uint64_t range = static_cast<uint64_t>(static_cast<int64_t>(maxValue) - static_cast<int64_t>(minValue));
+        forBits = bitsFor(range);
+        if (forBits <= MAX_PACKED_BITS && packedBytes(count, forBits) < bestSize) {
+            bestCodec = FOR;
+            bestSize = packedBytes(count, forBits);
+        }
+
+        int64_t maxDelta = 0;
+        for (size_t i = 1; i < count; i++) {
+            int64_t delta = static_cast<int64_t>(values[i]) - static_cast<int64_t>(values[i - 1]);
+            if (i == 1 || delta < minDelta) minDelta = delta;
+            if (i == 1 || delta > maxDelta) maxDelta = delta;
+        }
+        deltaBits = bitsFor(static_cast<uint64_t>(maxDelta - minDelta));
+        size_t deltaCount = (count > 0) ? count - 1 : 0;
+        if (deltaBits <= MAX_PACKED_BITS && packedBytes(deltaCount, deltaBits) < bestSize) {
+            bestCodec = DELTA;
+            bestSize = packedBytes(deltaCount, deltaBits);
+        }
+    }
+
+    encoding.codec = static_cast<uint8_t>(bestCodec);
+    bytes.assign(bestSize, 0);
+
+    switch (bestCodec) {
+        case FLOAT32: {
+            for (size_t i = 0; i < count; i++) {
+                float f = static_cast<float>(values[i]);
+                std::memcpy(bytes.data() + i * sizeof(float), &f, sizeof(float));
+            }
+            break;
+        }
+        case DICTIONARY: {
+            encoding.bitWidth = static_cast<uint8_t>(dictionaryBits);
+            encoding.dictionarySize = static_cast<uint32_t>(dictionary.size());
+            for (const auto& entry : dictionary) {
+                std::memcpy(bytes.data() + entry.second * sizeof(double), &entry.first, sizeof(double));
+            }
+            std::vector<uint64_t> codes(count);
+            for (size_t i = 0; i < count; i++) {
+                codes[i] = dictionary[bitsOf(values[i])];
+            }
+            pack(codes.data(), count, dictionaryBits, bytes.data() + dictionary.size() * sizeof(double));
+            break;
+        }
+        case FOR: {
+            encoding.bitWidth = static_cast<uint8_t>(forBits);
+            encoding.base = minValue;
+            int64_t base = static_cast<int64_t>(minValue);
+            std::vector<uint64_t> offsets(count);
+            for (size_t i = 0; i < count; i++) {
+                offsets[i] = static_cast<uint64_t>(static_cast<int64_t>(values[i]) - base);
+            }
+            pack(offsets.data(), count, forBits, bytes.data());
+            break;
+        }
+        case DELTA: {
+            encoding.bitWidth = static_cast<uint8_t>(deltaBits);
+            encoding.base = values[0];
+            encoding.reference = static_cast<double>(minDelta);
+            std::vector<uint64_t> offsets(count - 1);
+            for (size_t i = 1; i < count; i++) {
+                int64_t delta = static_cast<int64_t>(values[i]) - static_cast<int64_t>(values[i - 1]);
+                offsets[i - 1] = static_cast<uint64_t>(delta - minDelta);
+            }
+            pack(offsets.data(), count - 1, deltaBits, bytes.data());
+            break;
+        }
+        default: {
+            std::memcpy(bytes.data(), values, count * sizeof(double));
+            break;
+        }
+    }
+
+    encoding.size = bytes.size();
+}
+
+// Decode a column; each case is a simple loop with no data-dependent branches
+void ColumnCodec::decode(const ColumnEncoding& encoding, const unsigned char* bytes,
+                         size_t count, double* out) {
+    uint64_t mask = maskFor(encoding.bitWidth);
+
+    switch (encoding.codec) {
+        case FLOAT32: {
+            for (size_t i = 0; i < count; i++) {
+                float f;
+                std::memcpy(&f, bytes + i * sizeof(float), sizeof(float));
+                out[i] = static_cast<double>(f);
+            }
+            break;
+        }
+        case DICTIONARY: {
+            std::vector<double> table(encoding.dictionarySize);
+            std::memcpy(table.data(), bytes, table.size() * sizeof(double));
+            const unsigned char* codes = bytes + table.size() * sizeof(double);
+            for (size_t i = 0; i < count; i++) {
+                out[i] = table[unpack(codes, i, encoding.bitWidth, mask)];
+            }
+            break;
+        }
+        case FOR: {
+            int64_t base = static_cast<int64_t>(encoding.base);
+            for (size_t i = 0; i < count; i++) {
+                out[i] = static_cast<double>(base + static_cast<int64_t>(unpack(bytes, i, encoding.bitWidth, mask)));
+            }
+            break;
+        }
+        case DELTA: {
+            // Prefix sum: a serial dependency chain, unlike the loops above
+            if (count == 0) break;
+            int64_t value = static_cast<int64_t>(encoding.base);
+            int64_t minDelta = static_cast<int64_t>(encoding.reference);
+            out[0] = encoding.base;
+            for (size_t i = 1; i < count; i++) {
+                value += minDelta + static_cast<int64_t>(unpack(bytes, i - 1, encoding.bitWidth, mask));
+                out[i] = static_cast<double>(value);
+            }
+            break;
+        }
+        default: {
+            std::memcpy(out, bytes, count * sizeof(double));
+            break;
+        }
+    }
+}
+
+// Human readable codec name
+const char* ColumnCodec::codecName(int codec) {
+    switch (codec) {
+        case RAW: return "raw";
+        case FLOAT32: return "float32";
+        case DICTIONARY: return "dictionary";
+        case FOR: return "frame-of-reference";
+        case DELTA: return "delta";
+        default: return "unknown";
+    }
+}
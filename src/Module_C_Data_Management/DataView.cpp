@@ -0,0 +1,120 @@
+#include "DataView.h"
+#include <random>
+#include <stdexcept>
+
+// Default constructor - empty view
+DataView::DataView() : features(nullptr), labels(nullptr), identity(true) {}
+
+// View over all rows of a feature matrix without labels
+DataView::DataView(const Matrix& X) : features(&X), labels(nullptr), identity(true) {}
+
+// View over all rows of a feature matrix and its labels
+DataView::DataView(const Matrix& X, const Vector& y) : features(&X), labels(&y), identity(true) {
+    if (X.getRows() != y.getSize()) {
+        throw std::invalid_argument("Number of samples must match labels");
+    }
+}
+
+// View over selected rows
+DataView::DataView(const Matrix& X, const Vector& y, const std::vector<int>& rowIndices)
+    : features(&X), labels(&y), indices(rowIndices), identity(false) {
+    if (X.getRows() != y.getSize()) {
+        throw std::invalid_argument("Number of samples must match labels");
+    }
+    for (int index : indices) {
+        if (index < 0 || index >= X.getRows()) {
+            throw std::out_of_range("DataView row index out of bounds");
+        }
+    }
+}
+
+// Rebind the same row selection to another matrix
+DataView DataView::withFeatures(const Matrix& X) const {
+    if (features == nullptr || X.getRows() != features->getRows()) {
+        throw std::invalid_argument("Replacement matrix must have the same number of rows");
+    }
+    DataView view(*this);
+    view.features = &X;
+    return view;
+}
+
+// Shape
+int DataView::getRows() const {
+    if (features == nullptr) return 0;
+    return identity ? features->getRows() : static_cast<int>(indices.size());
+}
+
+int DataView::getCols() const {
+    return (features == nullptr) ? 0 : features->getCols();
+}
+
+bool DataView::hasLabels() const {
+    return labels != nullptr;
+}
+
+bool DataView::isIdentity() const {
+    return identity;
+}
+
+// Gather access
+int DataView::rowIndex(int i) const {
+    return identity ? i : indices[i];
+}
+
+const double* DataView::row(int i) const {
+    return features->rowData(rowIndex(i));
+}
+
+double DataView::getValue(int i, int col) const {
+    if (i < 0 || i >= getRows() || col < 0 || col >= getCols()) {
+        throw std::out_of_range("DataView index out of bounds");
+    }
+    return row(i)[col];
+}
+
+double DataView::getLabel(int i) const {
+    if (labels == nullptr) {
+        throw std::runtime_error("DataView has no labels");
+    }
+    return labels->rowData(rowIndex(i))[0];
+}
+
+const std::vector<int>& DataView::getIndices() const {
+    return indices;
+}
+
+// Copy the selected rows into a new matrix
+Matrix DataView::gatherFeatures() const {
+    int n = getRows();
+    int m = getCols();
+    Matrix result(n, m);
+    for (int i = 0; i < n; i++) {
+        const double* src = row(i);
+        double* dst = result.rowData(i);
+        for (int j = 0; j < m; j++) {
+            dst[j] = src[j];
+        }
+    }
+    return result;
+}
+
+// Copy the selected labels into a new vector
+Vector DataView::gatherLabels() const {
+    int n = getRows();
+    Vector result(n);
+    for (int i = 0; i < n; i++) {
+        result[i] = getLabel(i);
+    }
+    return result;
+}
+
+// Fisher-Yates shuffle driven by mt19937_64; the raw engine output is used
+// (instead of std::uniform_int_distribution) so a seed gives the same order
+// with every standard library
+void DataView::shuffleIndices(std::vector<int>& indices, unsigned long seed) {
+    std::mt19937_64 rng(seed);
+    for (size_t i = indices.size(); i > 1; i--) {
+        size_t j = static_cast<size_t>(rng() % i);
+        std::swap(indices[i - 1], indices[j]);
+    }
+}
@@ -1,14 +1,24 @@
 #include "Dataset.h"
+#include "DatasetCache.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <vector>
 #include <string>
+#include <utility>
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <stdexcept>
+#include <random>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 
 // Constructor
-Dataset::Dataset() : numSamples(0), numFeatures(0), filename("") {}
+Dataset::Dataset() : filename(""), numSamples(0), numFeatures(0), cacheEnabled(true) {}
 
-Dataset::Dataset(const std::string& filepath) : numSamples(0), numFeatures(0) {
+Dataset::Dataset(const std::string& filepath) : numSamples(0), numFeatures(0), cacheEnabled(true) {
     loadCSV(filepath);
 }
 
@@ -17,7 +27,22 @@ Dataset::~Dataset() {}
 
 // Load CSV file
 bool Dataset::loadCSV(const std::string& filepath) {
+    return loadCSV(filepath, CSVLoadOptions());
+}
+
+// Load CSV file, parsing only the selected columns of the sampled rows
+bool Dataset::loadCSV(const std::string& filepath, const CSVLoadOptions& options) {
     filename = filepath;
+    
+    // Fast path: an up-to-date binary cache needs no parsing at all
+    if (cacheEnabled && DatasetCache::load(filepath, columnNames, features, labels, options)) {
+        numSamples = features.getRows();
+        numFeatures = features.getCols();
+        std::cout << "Successfully loaded " << numSamples << " samples with " 
+                  << numFeatures << " features (binary cache)" << std::endl;
+        return true;
+    }
+    
     std::ifstream file(filepath);
     
     if (!file.is_open()) {
@@ -25,79 +50,166 @@ bool Dataset::loadCSV(const std::string& filepath) {
         return false;
     }
     
+    // Header line holds the column names; the last column is the label
     std::string line;
-    std::vector<std::vector<double>> tempData;
-    std::vector<double> tempLabels;
-    bool firstLine = true;
+    std::vector<std::string> header;
+    if (std::getline(file, line)) {
+        std::stringstream ss(trimLine(line));
+        std::string name;
+        while (std::getline(ss, name, ',')) {
+            header.push_back(name);
+        }
+    }
+    if (header.size() < 2) {
+        std::cerr << "Error: " << filepath << " needs a header with at least one feature and a label" << std::endl;
+        return false;
+    }
+    
+    // Map every field position to its output slot (-1 = skipped, never converted)
+    std::vector<int> selected = options.resolveColumns(header);
+    int numColumns = static_cast<int>(header.size());
+    int numSelected = static_cast<int>(selected.size());
+    int width = numSelected + 1;  // Selected features followed by the label
+    std::vector<int> slotOf(numColumns, -1);
+    for (int j = 0; j < numSelected; j++) {
+        slotOf[selected[j]] = j;
+    }
+    slotOf[numColumns - 1] = numSelected;
+    
+    // Rows are stored flat, width values per row
+    std::vector<double> values;
+    std::vector<double> row(width);
+    std::mt19937_64 rng(options.seed);
+    long long rowNumber = -1;
+    long long reservoirFilled = 0;
     
     while (std::getline(file, line)) {
-        // Skip header line
-        if (firstLine) {
-            firstLine = false;
+        const std::string& text = trimLine(line);
+        if (text.empty()) {
             continue;
         }
+        rowNumber++;
         
-        std::stringstream ss(line);
-        std::string value;
-        std::vector<double> row;
-        
-        // Parse comma-separated values
-        while (std::getline(ss, value, ',')) {
-            try {
-                row.push_back(std::stod(value));
-            } catch (const std::exception& e) {
-                std::cerr << "Error parsing value: " << value << std::endl;
-                continue;
+        // Decide on sampling before spending any time on the fields
+        long long target = -1;  // Reservoir slot to overwrite, -1 = append
+        if (options.sampling == CSVLoadOptions::EVERY_KTH) {
+            if (rowNumber % options.everyK != 0) continue;
+        } else if (options.sampling == CSVLoadOptions::BERNOULLI) {
+            double u = (rng() >> 11) * (1.0 / 9007199254740992.0);  // Uniform in [0, 1)
+            if (u >= options.probability) continue;
+        } else if (options.sampling == CSVLoadOptions::RESERVOIR) {
+            // Algorithm R: row t replaces a random slot with probability n / (t + 1)
+            if (reservoirFilled >= options.reservoirSize) {
+                long long j = static_cast<long long>(rng() % static_cast<unsigned long long>(rowNumber + 1));
+                if (j >= options.reservoirSize) continue;
+                target = j;
             }
         }
         
-        if (!row.empty()) {
-            // Last column is the label
-            tempLabels.push_back(row.back());
-            row.pop_back();
-            
-            // Remaining columns are features
-            if (!row.empty()) {
-                tempData.push_back(row);
-            }
+        if (!parseRow(text, slotOf, row.data())) {
+            continue;
+        }
+        
+        if (target >= 0) {
+            std::copy(row.begin(), row.end(), values.begin() + target * width);
+        } else {
+            values.insert(values.end(), row.begin(), row.end());
+            reservoirFilled++;
         }
     }
     
     file.close();
     
     // Convert to Matrix and Vector
-    numSamples = tempData.size();
-    if (numSamples > 0) {
-        numFeatures = tempData[0].size();
-        
-        // Create feature matrix
+    numSamples = static_cast<int>(values.size() / width);
+    numFeatures = numSelected;
+    if (numSamples > 0 && numFeatures > 0) {
         features = Matrix(numSamples, numFeatures);
+        labels = Vector(numSamples);
         for (int i = 0; i < numSamples; i++) {
-            for (int j = 0; j < numFeatures; j++) {
-                features.setValue(i, j, tempData[i][j]);
-            }
+            const double* src = values.data() + static_cast<size_t>(i) * width;
+            std::copy(src, src + numFeatures, features.rowData(i));
+            labels[i] = src[numFeatures];
         }
         
-        // Create label vector
-        labels = Vector(numSamples);
-        for (int i = 0; i < numSamples; i++) {
-            labels[i] = tempLabels[i];
+        columnNames.clear();
+        for (int index : selected) {
+            columnNames.push_back(header[index]);
         }
+        columnNames.push_back(header[numColumns - 1]);
         
         std::cout << "Successfully loaded " << numSamples << " samples with " 
                   << numFeatures << " features" << std::endl;
+        
+        // Write the binary cache so the next load skips parsing; only a full
+        // load has every column and row the cache must contain
+        if (cacheEnabled && options.isFullLoad()) {
+            if (!DatasetCache::save(filepath, columnNames, features, labels)) {
+                std::cerr << "Warning: Could not write dataset cache "
+                          << DatasetCache::cachePathFor(filepath) << std::endl;
+            }
+        }
         return true;
     }
     
+    numSamples = 0;
+    numFeatures = 0;
     return false;
 }
 
+// Strip a trailing carriage return / whitespace (CRLF files) in place
+const std::string& Dataset::trimLine(std::string& line) {
+    size_t end = line.size();
+    while (end > 0 && std::isspace(static_cast<unsigned char>(line[end - 1]))) {
+        end--;
+    }
+    line.resize(end);
+    return line;
+}
+
+// Parse one comma-separated line into its output slots. Fields whose slot is
+// -1 are skipped by scanning for the next comma, with no number conversion.
+// Returns false (and logs) for rows with missing or non-numeric selected fields.
+bool Dataset::parseRow(const std::string& line, const std::vector<int>& slotOf, double* out) {
+    const char* p = line.c_str();
+    const char* end = p + line.size();
+    int numColumns = static_cast<int>(slotOf.size());
+    
+    for (int field = 0; field < numColumns; field++) {
+        if (p > end) {
+            std::cerr << "Skipping row with too few fields: " << line << std::endl;
+            return false;
+        }
+        const char* fieldEnd = static_cast<const char*>(std::memchr(p, ',', end - p));
+        if (fieldEnd == nullptr) {
+            fieldEnd = end;
+        }
+        
+        int slot = slotOf[field];
+        if (slot >= 0) {
+            char* parsedEnd = nullptr;
+            double value = std::strtod(p, &parsedEnd);
+            const char* rest = parsedEnd;
+            while (rest < fieldEnd && std::isspace(static_cast<unsigned char>(*rest))) {
+                rest++;
+            }
+            if (parsedEnd == p || rest != fieldEnd) {
+                std::cerr << "Error parsing value: " << std::string(p, fieldEnd) << std::endl;
+                return false;
+            }
+            out[slot] = value;
+        }
+        p = fieldEnd + 1;
+    }
+    return true;
+}
+
 // Getters
-Matrix Dataset::getFeatures() const {
+const Matrix& Dataset::getFeatures() const {
     return features;
 }
 
-Vector Dataset::getLabels() const {
+const Vector& Dataset::getLabels() const {
     return labels;
 }
 
@@ -109,10 +221,121 @@ int Dataset::getNumFeatures() const {
     return numFeatures;
 }
 
+std::vector<std::string> Dataset::getColumnNames() const {
+    return columnNames;
+}
+
+void Dataset::setCacheEnabled(bool enabled) {
+    cacheEnabled = enabled;
+}
+
 void Dataset::getShape() const {
     std::cout << "Dataset shape: (" << numSamples << ", " << numFeatures << ")" << std::endl;
 }
 
+// Transfer ownership of the feature matrix to the caller without copying
+Matrix Dataset::releaseFeatures() {
+    Matrix released(std::move(features));
+    numSamples = 0;
+    numFeatures = 0;
+    return released;
+}
+
+// Transfer ownership of the label vector to the caller without copying
+Vector Dataset::releaseLabels() {
+    Vector released(std::move(labels));
+    numSamples = 0;
+    numFeatures = 0;
+    return released;
+}
+
+// Shuffled row indices; one group per distinct label when stratifying
+std::vector<std::vector<int>> Dataset::shuffledGroups(unsigned long seed, bool stratify) const {
+    std::map<double, std::vector<int>> byLabel;
+    for (int i = 0; i < numSamples; i++) {
+        byLabel[stratify ? labels[i] : 0.0].push_back(i);
+    }
+    
+    std::vector<std::vector<int>> groups;
+    unsigned long groupSeed = seed;
+    for (auto& entry : byLabel) {
+        DataView::shuffleIndices(entry.second, groupSeed++);
+        groups.push_back(std::move(entry.second));
+    }
+    return groups;
+}
+
+// View over every row in file order
+DataView Dataset::view() const {
+    return DataView(features, labels);
+}
+
+// Seeded permutation of all rows
+DataView Dataset::shuffled(unsigned long seed) const {
+    std::vector<int> indices(numSamples);
+    for (int i = 0; i < numSamples; i++) {
+        indices[i] = i;
+    }
+    DataView::shuffleIndices(indices, seed);
+    return DataView(features, labels, indices);
+}
+
+// Random train/test split; with stratify each label keeps its class ratio.
+// Index lists are sorted so both views walk the matrix in memory order.
+DataSplit Dataset::trainTestSplit(double testRatio, unsigned long seed, bool stratify) const {
+    if (testRatio <= 0.0 || testRatio >= 1.0) {
+        throw std::invalid_argument("Test ratio must be between 0 and 1");
+    }
+    
+    std::vector<int> trainIndices;
+    std::vector<int> testIndices;
+    for (const std::vector<int>& group : shuffledGroups(seed, stratify)) {
+        int testCount = static_cast<int>(std::round(group.size() * testRatio));
+        testIndices.insert(testIndices.end(), group.begin(), group.begin() + testCount);
+        trainIndices.insert(trainIndices.end(), group.begin() + testCount, group.end());
+    }
+    std::sort(trainIndices.begin(), trainIndices.end());
+    std::sort(testIndices.begin(), testIndices.end());
+    
+    DataSplit split;
+    split.train = DataView(features, labels, trainIndices);
+    split.test = DataView(features, labels, testIndices);
+    return split;
+}
+
+// k-fold partitions: fold f validates on every k-th shuffled row (per label
+// when stratifying) and trains on the rest
+std::vector<DataSplit> Dataset::kFold(int k, unsigned long seed, bool stratify) const {
+    if (k < 2 || k > numSamples) {
+        throw std::invalid_argument("Number of folds must be between 2 and the number of samples");
+    }
+    
+    // Deal shuffled rows round-robin so every fold gets its share of each class
+    std::vector<int> foldOf(numSamples);
+    int next = 0;
+    for (const std::vector<int>& group : shuffledGroups(seed, stratify)) {
+        for (int index : group) {
+            foldOf[index] = next;
+            next = (next + 1) % k;
+        }
+    }
+    
+    std::vector<DataSplit> folds;
+    for (int f = 0; f < k; f++) {
+        std::vector<int> trainIndices;
+        std::vector<int> testIndices;
+        for (int i = 0; i < numSamples; i++) {
+            (foldOf[i] == f ? testIndices : trainIndices).push_back(i);
+        }
+        
+        DataSplit split;
+        split.train = DataView(features, labels, trainIndices);
+        split.test = DataView(features, labels, testIndices);
+        folds.push_back(std::move(split));
+    }
+    return folds;
+}
+
 // Display first n rows
 void Dataset::displayHead(int n) const {
     std::cout << "\nFirst " << n << " rows of dataset:" << std::endl;
@@ -0,0 +1,274 @@
+#include "DatasetCache.h"
+#include "MappedFile.h"
+#include "ColumnCodec.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+
+namespace {
+
+const char CACHE_MAGIC[8] = {'T', 'L', 'C', 'A', 'C', 'H', 'E', '\0'};
+const uint32_t CACHE_VERSION = 2;  // 2: compressed columns with a codec directory
+const uint64_t CACHE_ALIGNMENT = 64;
+
+// Fixed-size file header, exactly one alignment unit long
+struct CacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t numColumns;     // Feature columns + 1 label column
+    uint64_t numRows;
+    uint64_t sourceSize;     // Size of the CSV the cache was built from
+    int64_t sourceTime;      // Modification time of that CSV
+    uint64_t schemaBytes;    // Padded size of the schema section
+    uint64_t checksum;       // Checksum of schema, column data and directory
+    uint64_t reserved;
+};
+static_assert(sizeof(CacheHeader) == CACHE_ALIGNMENT, "Cache header must fill one alignment unit");
+static_assert(sizeof(ColumnEncoding) == 40, "Column directory entries are 40 bytes");
+
+uint64_t alignUp(uint64_t value) {
+    return (value + CACHE_ALIGNMENT - 1) / CACHE_ALIGNMENT * CACHE_ALIGNMENT;
+}
+
+// Size and modification time identify the version of the source CSV
+bool sourceFingerprint(const std::string& csvPath, uint64_t& size, int64_t& time) {
+    std::error_code ec;
+    auto fileSize = std::filesystem::file_size(csvPath, ec);
+    if (ec) return false;
+    auto writeTime = std::filesystem::last_write_time(csvPath, ec);
+    if (ec) return false;
+
+    size = static_cast<uint64_t>(fileSize);
+    time = static_cast<int64_t>(writeTime.time_since_epoch().count());
+    return true;
+}
+
+// Schema section: [uint32 length][bytes] per column, zero padded to alignment
+std::vector<unsigned char> encodeSchema(const std::vector<std::string>& columnNames) {
+    std::vector<unsigned char> schema;
+    for (const std::string& name : columnNames) {
+        uint32_t len = static_cast<uint32_t>(name.size());
+        const unsigned char* lenBytes = reinterpret_cast<const unsigned char*>(&len);
+        schema.insert(schema.end(), lenBytes, lenBytes + sizeof(len));
+        schema.insert(schema.end(), name.begin(), name.end());
+    }
+    schema.resize(alignUp(schema.size()), 0);
+    return schema;
+}
+
+bool decodeSchema(const unsigned char* p, uint64_t size, uint32_t count, std::vector<std::string>& names) {
+    names.clear();
+    uint64_t pos = 0;
+    for (uint32_t c = 0; c < count; c++) {
+        uint32_t len;
+        if (pos + sizeof(len) > size) return false;
+        std::memcpy(&len, p + pos, sizeof(len));
+        pos += sizeof(len);
+        if (pos + len > size) return false;
+        names.emplace_back(reinterpret_cast<const char*>(p + pos), len);
+        pos += len;
+    }
+    return true;
+}
+
+} // namespace
+
+// Cache file location: next to the CSV
+std::string DatasetCache::cachePathFor(const std::string& csvPath) {
+    return csvPath + ".tlcache";
+}
+
+// Write the cache to a temporary file and rename it into place,
+// so a concurrent reader never observes a half-written cache
+bool DatasetCache::save(const std::string& csvPath,
+                        const std::vector<std::string>& columnNames,
+                        const Matrix& features,
+                        const Vector& labels) {
+    uint64_t numRows = static_cast<uint64_t>(features.getRows());
+    int numFeatures = features.getCols();
+
+    if (static_cast<int>(columnNames.size()) != numFeatures + 1 ||
+        labels.getSize() != features.getRows()) {
+        return false;
+    }
+
+    CacheHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+    header.version = CACHE_VERSION;
+    header.numColumns = static_cast<uint32_t>(numFeatures + 1);
+    header.numRows = numRows;
+    if (!sourceFingerprint(csvPath, header.sourceSize, header.sourceTime)) {
+        return false;
+    }
+
+    std::vector<unsigned char> schema = encodeSchema(columnNames);
+    header.schemaBytes = schema.size();
+
+    uint64_t directoryBytes = alignUp(header.numColumns * sizeof(ColumnEncoding));
+    uint64_t dataStart = sizeof(CacheHeader) + schema.size() + directoryBytes;
+    std::vector<ColumnEncoding> directory(header.numColumns);
+
+    std::string cachePath = cachePathFor(csvPath);
+    std::string tempPath = cachePath + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+
+        // Header and directory are rewritten once every column is encoded
+        std::vector<unsigned char> zeros(dataStart - sizeof(CacheHeader) - schema.size(), 0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(schema.data()), static_cast<std::streamsize>(schema.size()));
+        out.write(reinterpret_cast<const char*>(zeros.data()), static_cast<std::streamsize>(zeros.size()));
+
+        // Every section is a multiple of 8 bytes, so chaining the checksum matches a single pass
+        uint64_t hash = MappedFile::checksum(schema.data(), schema.size());
+
+        // Gather one column at a time, pick its codec and append it 64-byte aligned
+        std::vector<double> column(numRows);
+        std::vector<unsigned char> encoded;
+        uint64_t offset = dataStart;
+        for (int j = 0; j <= numFeatures; j++) {
+            for (uint64_t i = 0; i < numRows; i++) {
+                int row = static_cast<int>(i);
+                column[i] = (j < numFeatures) ? features.rowData(row)[j] : labels.rowData(row)[0];
+            }
+
+            ColumnCodec::encode(column.data(), column.size(), directory[j], encoded);
+            directory[j].offset = offset;
+            encoded.resize(alignUp(encoded.size()), 0);
+
+            hash = MappedFile::checksum(encoded.data(), encoded.size(), hash);
+            out.write(reinterpret_cast<const char*>(encoded.data()), static_cast<std::streamsize>(encoded.size()));
+            offset += encoded.size();
+        }
+
+        std::vector<unsigned char> directoryBlock(directoryBytes, 0);
+        std::memcpy(directoryBlock.data(), directory.data(), directory.size() * sizeof(ColumnEncoding));
+        header.checksum = MappedFile::checksum(directoryBlock.data(), directoryBlock.size(), hash);
+
+        out.seekp(0);
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.seekp(static_cast<std::streamoff>(sizeof(CacheHeader) + schema.size()));
+        out.write(reinterpret_cast<const char*>(directoryBlock.data()), static_cast<std::streamsize>(directoryBlock.size()));
+
+        if (!out) {
+            out.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, cachePath, ec);
+    if (ec) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    return true;
+}
+
+// Map the cache and copy its columns into the row-major feature matrix
+bool DatasetCache::load(const std::string& csvPath,
+                        std::vector<std::string>& columnNames,
+                        Matrix& features,
+                        Vector& labels,
+                        const CSVLoadOptions& options) {
+    if (options.sampling != CSVLoadOptions::ALL_ROWS) {
+        return false;
+    }
+    
+    uint64_t sourceSize;
+    int64_t sourceTime;
+    if (!sourceFingerprint(csvPath, sourceSize, sourceTime)) {
+        return false;
+    }
+
+    MappedFile file;
+    if (!file.open(cachePathFor(csvPath)) || file.getSize() < sizeof(CacheHeader)) {
+        return false;
+    }
+
+    CacheHeader header;
+    std::memcpy(&header, file.getData(), sizeof(header));
+    if (std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC)) != 0 ||
+        header.version != CACHE_VERSION ||
+        header.sourceSize != sourceSize ||
+        header.sourceTime != sourceTime ||
+        header.numColumns < 2) {
+        return false;  // Foreign, outdated or stale cache
+    }
+
+    uint64_t directoryStart = sizeof(CacheHeader) + header.schemaBytes;
+    uint64_t directoryBytes = alignUp(header.numColumns * sizeof(ColumnEncoding));
+    uint64_t dataStart = directoryStart + directoryBytes;
+    if (header.schemaBytes % CACHE_ALIGNMENT != 0 || file.getSize() < dataStart) {
+        return false;
+    }
+
+    // Checksum order matches the writer: schema, column data, directory
+    const unsigned char* base = file.getData();
+    uint64_t hash = MappedFile::checksum(base + sizeof(CacheHeader), header.schemaBytes);
+    hash = MappedFile::checksum(base + dataStart, file.getSize() - dataStart, hash);
+    hash = MappedFile::checksum(base + directoryStart, directoryBytes, hash);
+    if (hash != header.checksum) {
+        return false;
+    }
+
+    std::vector<ColumnEncoding> directory(header.numColumns);
+    std::memcpy(directory.data(), base + directoryStart, directory.size() * sizeof(ColumnEncoding));
+    for (const ColumnEncoding& entry : directory) {
+        if (entry.offset < dataStart || entry.offset + entry.size > file.getSize()) {
+            return false;
+        }
+    }
+
+    const unsigned char* payload = base + sizeof(CacheHeader);
+    std::vector<std::string> names;
+    if (!decodeSchema(payload, header.schemaBytes, header.numColumns, names)) {
+        return false;
+    }
+
+    std::vector<int> selected;
+    try {
+        selected = options.resolveColumns(names);
+    } catch (const std::invalid_argument&) {
+        return false;  // Let the CSV path report the bad selection
+    }
+
+    int numRows = static_cast<int>(header.numRows);
+    int labelColumnIndex = static_cast<int>(header.numColumns) - 1;
+    int numSelected = static_cast<int>(selected.size());
+
+    // Only the selected columns are decoded, each into a contiguous buffer
+    // first (tight codec loops) and then scattered into the row-major matrix
+    std::vector<double> column(numRows);
+    features = Matrix(numRows, numSelected);
+    for (int j = 0; j < numSelected; j++) {
+        const ColumnEncoding& entry = directory[selected[j]];
+        ColumnCodec::decode(entry, base + entry.offset, column.size(), column.data());
+        for (int i = 0; i < numRows; i++) {
+            features.rowData(i)[j] = column[i];
+        }
+    }
+
+    const ColumnEncoding& labelEntry = directory[labelColumnIndex];
+    ColumnCodec::decode(labelEntry, base + labelEntry.offset, column.size(), column.data());
+    labels = Vector(numRows);
+    for (int i = 0; i < numRows; i++) {
+        labels.rowData(i)[0] = column[i];
+    }
+
+    columnNames.clear();
+    for (int index : selected) {
+        columnNames.push_back(names[index]);
+    }
+    columnNames.push_back(names[labelColumnIndex]);
+    return true;
+}
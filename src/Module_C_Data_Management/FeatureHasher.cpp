@@ -0,0 +1,206 @@
+#include "FeatureHasher.h"
+#include "Dataset.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
+
+namespace {
+const uint64_t FNV_OFFSET = 14695981039346656037ULL;
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+// Final avalanche so the low bits used for the column depend on every byte
+uint64_t finalize(uint64_t h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+// Field text without surrounding whitespace
+void trimField(const char*& begin, const char*& end) {
+    while (begin < end && std::isspace(static_cast<unsigned char>(*begin))) begin++;
+    while (end > begin && std::isspace(static_cast<unsigned char>(end[-1]))) end--;
+}
+
+// What a field's text converts to
+enum FieldKind { TEXT, FINITE_NUMBER, NON_FINITE_NUMBER };
+
+// Whole-field numeric conversion. strtod also accepts "nan", "inf" and
+// overflowing literals; those are reported separately so they can be
+// rejected instead of reaching the model
+FieldKind parseNumber(const char* begin, const char* end, double& value) {
+    char* parsedEnd = nullptr;
+    value = std::strtod(begin, &parsedEnd);
+    if (parsedEnd == begin || parsedEnd != end) {
+        return TEXT;
+    }
+    return std::isfinite(value) ? FINITE_NUMBER : NON_FINITE_NUMBER;
+}
+}
+
+// Constructor
+FeatureHasher::FeatureHasher(int bits, bool signedHash) : numBits(bits), alternateSign(signedHash) {
+    if (bits < 1 || bits > 30) {
+        throw std::invalid_argument("Number of hash bits must be between 1 and 30");
+    }
+    mask = (1u << bits) - 1u;
+}
+
+// Destructor
+FeatureHasher::~FeatureHasher() {}
+
+// Byte-wise FNV-1a continuing from seed
+uint64_t FeatureHasher::hashBytes(uint64_t seed, const char* begin, const char* end) {
+    uint64_t h = seed;
+    for (const char* p = begin; p < end; p++) {
+        h ^= static_cast<unsigned char>(*p);
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+// Hash state after the column name
+uint64_t FeatureHasher::columnSeed(const std::string& name) const {
+    return hashBytes(FNV_OFFSET, name.data(), name.data() + name.size());
+}
+
+// Numeric fields keep their value under the column's own hash; anything
+// else is a category and hashes "name=value" with value 1
+bool FeatureHasher::hashField(uint64_t seed, const char* begin, const char* end,
+                              std::vector<std::pair<int, double>>& row) const {
+    trimField(begin, end);
+    if (begin == end) {
+        return true;
+    }
+
+    double value = 0.0;
+    uint64_t h;
+    FieldKind kind = parseNumber(begin, end, value);
+    if (kind == NON_FINITE_NUMBER) {
+        return false;
+    }
+    if (kind == FINITE_NUMBER) {
+        h = finalize(seed);
+    } else {
+        const char separator = '=';
+        h = finalize(hashBytes(hashBytes(seed, &separator, &separator + 1), begin, end));
+        value = 1.0;
+    }
+
+    if (alternateSign && (h >> 63) != 0) {
+        value = -value;
+    }
+    row.push_back(std::make_pair(static_cast<int>(h & mask), value));
+    return true;
+}
+
+// Stream the CSV once; only the current row's fields are ever held in memory
+bool FeatureHasher::loadCSV(const std::string& filepath, SparseMatrix& features, Vector& labels) const {
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        std::cerr << "Error: Could not open file " << filepath << std::endl;
+        return false;
+    }
+
+    std::string line;
+    std::vector<uint64_t> seeds;
+    if (std::getline(file, line)) {
+        std::stringstream ss(Dataset::trimLine(line));
+        std::string name;
+        while (std::getline(ss, name, ',')) {
+            seeds.push_back(columnSeed(name));
+        }
+    }
+    if (seeds.size() < 2) {
+        std::cerr << "Error: " << filepath << " needs a header with at least one feature and a label" << std::endl;
+        return false;
+    }
+    int numColumns = static_cast<int>(seeds.size());
+
+    SparseMatrix X(getNumFeatures());
+    std::vector<double> y;
+    std::vector<std::pair<int, double>> row;
+
+    while (std::getline(file, line)) {
+        const std::string& text = Dataset::trimLine(line);
+        if (text.empty()) {
+            continue;
+        }
+
+        const char* p = text.c_str();
+        const char* end = p + text.size();
+        row.clear();
+        bool complete = true;
+        bool finite = true;
+        double label = 0.0;
+
+        for (int field = 0; field < numColumns; field++) {
+            if (p > end) {
+                complete = false;
+                break;
+            }
+            const char* fieldEnd = static_cast<const char*>(std::memchr(p, ',', end - p));
+            if (fieldEnd == nullptr) {
+                fieldEnd = end;
+            }
+            if (field == numColumns - 1) {
+                const char* labelBegin = p;
+                const char* labelEnd = fieldEnd;
+                trimField(labelBegin, labelEnd);
+                FieldKind kind = parseNumber(labelBegin, labelEnd, label);
+                complete = (kind != TEXT);
+                finite = finite && (kind == FINITE_NUMBER);
+            } else {
+                finite = hashField(seeds[field], p, fieldEnd, row) && finite;
+            }
+            p = fieldEnd + 1;
+        }
+
+        if (!complete) {
+            std::cerr << "Skipping row without a numeric label: " << text << std::endl;
+            continue;
+        }
+        if (!finite) {
+            std::cerr << "Skipping row with a NaN or infinite value: " << text << std::endl;
+            continue;
+        }
+        X.appendRow(row);
+        y.push_back(label);
+    }
+    file.close();
+
+    if (y.empty()) {
+        return false;
+    }
+
+    labels = Vector(static_cast<int>(y.size()));
+    std::copy(y.begin(), y.end(), labels.rawData());
+    features = std::move(X);
+
+    std::cout << "Successfully hashed " << features.getRows() << " samples into "
+              << features.getCols() << " sparse features (" << features.getNonZeros()
+              << " non-zeros)" << std::endl;
+    return true;
+}
+
+// Getters
+int FeatureHasher::getNumFeatures() const {
+    return static_cast<int>(mask) + 1;
+}
+
+int FeatureHasher::getNumBits() const {
+    return numBits;
+}
+
+bool FeatureHasher::getAlternateSign() const {
+    return alternateSign;
+}
@@ -0,0 +1,116 @@
+#include "MappedFile.h"
+#include <cstring>
+#include <fstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TITAN_HAVE_MMAP 1
+#endif
+
+// Constructor
+MappedFile::MappedFile() : bytes(nullptr), length(0), mapped(false) {}
+
+// Destructor
+MappedFile::~MappedFile() {
+    close();
+}
+
+// Map the whole file read-only
+bool MappedFile::open(const std::string& filepath) {
+    close();
+
+#ifdef TITAN_HAVE_MMAP
+    int fd = ::open(filepath.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size <= 0) {
+        ::close(fd);
+        return false;
+    }
+
+    void* region = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);  // The mapping stays valid after the descriptor is closed
+    if (region == MAP_FAILED) {
+        return false;
+    }
+
+    bytes = static_cast<const unsigned char*>(region);
+    length = static_cast<size_t>(info.st_size);
+    mapped = true;
+    return true;
+#else
+    std::ifstream file(filepath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return false;
+    }
+
+    std::streamsize size = file.tellg();
+    if (size <= 0) {
+        return false;
+    }
+
+    buffer.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer.data()), size)) {
+        buffer.clear();
+        return false;
+    }
+
+    bytes = buffer.data();
+    length = buffer.size();
+    return true;
+#endif
+}
+
+// Release the mapping
+void MappedFile::close() {
+#ifdef TITAN_HAVE_MMAP
+    if (mapped && bytes != nullptr) {
+        munmap(const_cast<unsigned char*>(bytes), length);
+    }
+#endif
+    buffer.clear();
+    bytes = nullptr;
+    length = 0;
+    mapped = false;
+}
+
+// Getters
+const unsigned char* MappedFile::getData() const {
+    return bytes;
+}
+
+size_t MappedFile::getSize() const {
+    return length;
+}
+
+bool MappedFile::isOpen() const {
+    return bytes != nullptr;
+}
+
+// FNV-1a style hash over 64-bit words (8x fewer multiplies than byte-wise FNV),
+// chained through the seed so large payloads can be hashed in pieces
+uint64_t MappedFile::checksum(const void* data, size_t size, uint64_t seed) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    const uint64_t prime = 1099511628211ULL;
+    uint64_t hash = seed;
+
+    size_t words = size / sizeof(uint64_t);
+    for (size_t i = 0; i < words; i++) {
+        uint64_t word;
+        std::memcpy(&word, p + i * sizeof(uint64_t), sizeof(uint64_t));
+        hash ^= word;
+        hash *= prime;
+    }
+    for (size_t i = words * sizeof(uint64_t); i < size; i++) {
+        hash ^= p[i];
+        hash *= prime;
+    }
+    return hash;
+}
@@ -1,80 +1,86 @@
 #include "MinMaxScaler.h"
-#include <iostream>
-#include <stdexcept>
+#include "Parallel.h"
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 // Constructor
-MinMaxScaler::MinMaxScaler() : isFitted(false) {}
+MinMaxScaler::MinMaxScaler() : hasData(false) {}
 
 // Destructor
 MinMaxScaler::~MinMaxScaler() {}
 
-// Fit method - learn min and max values for each feature
-void MinMaxScaler::fit(const Matrix& data) {
-    int numFeatures = data.getCols();
-    int numSamples = data.getRows();
-    
-    if (numSamples == 0 || numFeatures == 0) {
-        throw std::invalid_argument("Cannot fit scaler on empty data");
-    }
+// Forget the running min and max
+void MinMaxScaler::resetStatistics(int features) {
+    minValues = Vector(features);
+    maxValues = Vector(features);
+    hasData = false;
+}
+
+// Fold a chunk into the running min and max
+void MinMaxScaler::accumulate(const DataView& chunk) {
+    int features = chunk.getCols();
+    int numSamples = chunk.getRows();
     
-    // Initialize min and max vectors
-    minValues = Vector(numFeatures);
-    maxValues = Vector(numFeatures);
+    // Each row block keeps its own min/max, merged after the join
+    int blocks = Parallel::blockCount(numSamples, Parallel::ROWS_PER_BLOCK);
+    std::vector<std::vector<double>> blockMin(blocks);
+    std::vector<std::vector<double>> blockMax(blocks);
     
-    // Find min and max for each feature (column)
-    for (int col = 0; col < numFeatures; col++) {
-        double minVal = data.getValue(0, col);
-        double maxVal = data.getValue(0, col);
+    Parallel::forRange(0, numSamples, Parallel::ROWS_PER_BLOCK, [&](int block, int begin, int end) {
+        std::vector<double> mn(chunk.row(begin), chunk.row(begin) + features);
+        std::vector<double> mx(mn);
+        double* lo = mn.data();
+        double* hi = mx.data();
         
-        for (int row = 1; row < numSamples; row++) {
-            double value = data.getValue(row, col);
-            if (value < minVal) minVal = value;
-            if (value > maxVal) maxVal = value;
+        // Single row-wise pass: all columns updated per row, branch-free
+        for (int row = begin + 1; row < end; row++) {
+            const double* x = chunk.row(row);
+            for (int col = 0; col < features; col++) {
+                lo[col] = x[col] < lo[col] ? x[col] : lo[col];
+                hi[col] = x[col] > hi[col] ? x[col] : hi[col];
+            }
+        }
+        blockMin[block] = std::move(mn);
+        blockMax[block] = std::move(mx);
+    });
+    
+    // Merge block results into the running values
+    for (int col = 0; col < features; col++) {
+        double minVal = hasData ? minValues[col] : blockMin[0][col];
+        double maxVal = hasData ? maxValues[col] : blockMax[0][col];
+        for (int b = 0; b < blocks; b++) {
+            minVal = std::min(minVal, blockMin[b][col]);
+            maxVal = std::max(maxVal, blockMax[b][col]);
         }
-        
         minValues[col] = minVal;
         maxValues[col] = maxVal;
     }
-    
-    isFitted = true;
-    std::cout << "MinMaxScaler fitted successfully" << std::endl;
+    hasData = true;
 }
 
-// Transform method - apply min-max scaling
-Matrix MinMaxScaler::transform(const Matrix& data) {
-    if (!isFitted) {
-        throw std::runtime_error("Scaler must be fitted before transform");
-    }
-    
-    int numSamples = data.getRows();
-    int numFeatures = data.getCols();
-    
-    if (numFeatures != minValues.getSize()) {
-        throw std::invalid_argument("Number of features must match fitted data");
-    }
-    
-    Matrix scaled(numSamples, numFeatures);
-    
-    // Apply min-max scaling: X_scaled = (X - X_min) / (X_max - X_min)
-    for (int row = 0; row < numSamples; row++) {
-        for (int col = 0; col < numFeatures; col++) {
-            double value = data.getValue(row, col);
-            double minVal = minValues[col];
-            double maxVal = maxValues[col];
-            
-            // Avoid division by zero
-            if (maxVal - minVal > 1e-10) {
-                double scaledValue = (value - minVal) / (maxVal - minVal);
-                scaled.setValue(row, col, scaledValue);
-            } else {
-                // If all values are the same, set to 0.5
-                scaled.setValue(row, col, 0.5);
-            }
+// scale = 1 / (max - min), offset = -min * scale
+void MinMaxScaler::computeAffine() {
+    int features = minValues.getSize();
+    scale = Vector(features);
+    offset = Vector(features);
+    for (int col = 0; col < features; col++) {
+        double minVal = minValues[col];
+        double maxVal = maxValues[col];
+        
+        // Avoid division by zero: constant features map to 0.5
+        if (maxVal - minVal > 1e-10) {
+            scale[col] = 1.0 / (maxVal - minVal);
+            offset[col] = -minVal * scale[col];
+        } else {
+            scale[col] = 0.0;
+            offset[col] = 0.5;
         }
     }
-    
-    std::cout << "Data transformed successfully" << std::endl;
-    return scaled;
+}
+
+const char* MinMaxScaler::getName() const {
+    return "MinMaxScaler";
 }
 
 // Getters
@@ -85,7 +91,3 @@ Vector MinMaxScaler::getMinValues() const {
 Vector MinMaxScaler::getMaxValues() const {
     return maxValues;
 }
-
-bool MinMaxScaler::getIsFitted() const {
-    return isFitted;
-}
@@ -0,0 +1,67 @@
+#include "RobustScaler.h"
+#include "Parallel.h"
+#include <algorithm>
+
+// Constructor
+RobustScaler::RobustScaler() {}
+
+// Destructor
+RobustScaler::~RobustScaler() {}
+
+// Fresh sketches for every feature
+void RobustScaler::resetStatistics(int features) {
+    lowerQuartiles.assign(features, QuantileSketch(0.25));
+    medians.assign(features, QuantileSketch(0.5));
+    upperQuartiles.assign(features, QuantileSketch(0.75));
+}
+
+// Sketches consume values in order, so split the work by column, not by row
+void RobustScaler::accumulate(const DataView& chunk) {
+    int rows = chunk.getRows();
+    // A block of columns should hold about as many values as a row block
+    int minColumns = std::max(1, Parallel::ROWS_PER_BLOCK / std::max(1, rows));
+
+    Parallel::forRange(0, chunk.getCols(), minColumns, [&](int, int begin, int end) {
+        for (int row = 0; row < rows; row++) {
+            const double* x = chunk.row(row);
+            for (int col = begin; col < end; col++) {
+                lowerQuartiles[col].add(x[col]);
+                medians[col].add(x[col]);
+                upperQuartiles[col].add(x[col]);
+            }
+        }
+    });
+}
+
+// scale = 1 / IQR, offset = -median / IQR
+void RobustScaler::computeAffine() {
+    int features = static_cast<int>(medians.size());
+    scale = Vector(features);
+    offset = Vector(features);
+    for (int j = 0; j < features; j++) {
+        double iqr = upperQuartiles[j].getEstimate() - lowerQuartiles[j].getEstimate();
+        scale[j] = (iqr > 1e-10) ? 1.0 / iqr : 1.0;
+        offset[j] = -medians[j].getEstimate() * scale[j];
+    }
+}
+
+const char* RobustScaler::getName() const {
+    return "RobustScaler";
+}
+
+// Getters
+Vector RobustScaler::getMedians() const {
+    Vector result(static_cast<int>(medians.size()));
+    for (int j = 0; j < result.getSize(); j++) {
+        result[j] = medians[j].getEstimate();
+    }
+    return result;
+}
+
+Vector RobustScaler::getInterquartileRanges() const {
+    Vector result(static_cast<int>(medians.size()));
+    for (int j = 0; j < result.getSize(); j++) {
+        result[j] = upperQuartiles[j].getEstimate() - lowerQuartiles[j].getEstimate();
+    }
+    return result;
+}
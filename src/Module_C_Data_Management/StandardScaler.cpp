@@ -0,0 +1,106 @@
+#include "StandardScaler.h"
+#include "Parallel.h"
+#include <cmath>
+#include <vector>
+
+namespace {
+// count / mean / M2 summary of one row block
+struct Moments {
+    double count;
+    std::vector<double> mean;
+    std::vector<double> m2;
+};
+
+// Chan et al. pairwise merge of two summaries into (count, mean, m2)
+void mergeMoments(double& count, double* mean, double* m2, const Moments& other, int features) {
+    if (other.count == 0) return;
+    double total = count + other.count;
+    double weight = other.count / total;
+    double cross = count * other.count / total;
+    for (int j = 0; j < features; j++) {
+        double delta = other.mean[j] - mean[j];
+        mean[j] += delta * weight;
+        m2[j] += other.m2[j] + delta * delta * cross;
+    }
+    count = total;
+}
+}
+
+// Constructor
+StandardScaler::StandardScaler() : count(0.0) {}
+
+// Destructor
+StandardScaler::~StandardScaler() {}
+
+// Forget everything seen so far
+void StandardScaler::resetStatistics(int features) {
+    count = 0.0;
+    means = Vector(features, 0.0);
+    m2 = Vector(features, 0.0);
+}
+
+// Summarize each row block with Welford's update, then merge into the totals
+void StandardScaler::accumulate(const DataView& chunk) {
+    int features = chunk.getCols();
+    int blocks = Parallel::blockCount(chunk.getRows(), Parallel::ROWS_PER_BLOCK);
+    std::vector<Moments> partial(blocks);
+
+    Parallel::forRange(0, chunk.getRows(), Parallel::ROWS_PER_BLOCK, [&](int block, int begin, int end) {
+        Moments& m = partial[block];
+        m.count = 0.0;
+        m.mean.assign(features, 0.0);
+        m.m2.assign(features, 0.0);
+        double* mean = m.mean.data();
+        double* sq = m.m2.data();
+
+        // The count is shared by all features, so one division per row
+        for (int row = begin; row < end; row++) {
+            const double* x = chunk.row(row);
+            m.count += 1.0;
+            double inv = 1.0 / m.count;
+            for (int j = 0; j < features; j++) {
+                double delta = x[j] - mean[j];
+                mean[j] += delta * inv;
+                sq[j] += delta * (x[j] - mean[j]);
+            }
+        }
+    });
+
+    // Merge in block order so the result does not depend on thread timing
+    for (const Moments& m : partial) {
+        mergeMoments(count, means.rawData(), m2.rawData(), m, features);
+    }
+}
+
+// scale = 1 / std, offset = -mean / std
+void StandardScaler::computeAffine() {
+    int features = means.getSize();
+    scale = Vector(features);
+    offset = Vector(features);
+    for (int j = 0; j < features; j++) {
+        double stdDev = (count > 0) ? std::sqrt(m2[j] / count) : 0.0;
+        scale[j] = (stdDev > 1e-10) ? 1.0 / stdDev : 1.0;
+        offset[j] = -means[j] * scale[j];
+    }
+}
+
+const char* StandardScaler::getName() const {
+    return "StandardScaler";
+}
+
+// Getters
+Vector StandardScaler::getMeans() const {
+    return means;
+}
+
+Vector StandardScaler::getStandardDeviations() const {
+    Vector result(means.getSize());
+    for (int j = 0; j < result.getSize(); j++) {
+        result[j] = (count > 0) ? std::sqrt(m2[j] / count) : 0.0;
+    }
+    return result;
+}
+
+double StandardScaler::getCount() const {
+    return count;
+}
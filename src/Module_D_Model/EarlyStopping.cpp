@@ -0,0 +1,74 @@
+#include "EarlyStopping.h"
+#include <cmath>
+#include <limits>
+#include <sstream>
+
+// Constructor
+EarlyStopping::EarlyStopping(const StoppingCriteria& stoppingCriteria, bool useValidation)
+    : criteria(stoppingCriteria), monitorValidation(useValidation),
+      previousLoss(std::numeric_limits<double>::quiet_NaN()),
+      bestValidationLoss(std::numeric_limits<double>::infinity()),
+      bestEpoch(-1), staleEpochs(0), bestBias(0.0) {}
+
+// Check every enabled criterion against this epoch
+bool EarlyStopping::update(int epoch, double trainingLoss, double gradientNorm,
+                           double validationLoss, const Vector& weights, double bias) {
+    std::ostringstream why;
+
+    if (monitorValidation) {
+        if (validationLoss < bestValidationLoss - criteria.minImprovement) {
+            bestValidationLoss = validationLoss;
+            bestEpoch = epoch;
+            bestWeights = weights;
+            bestBias = bias;
+            staleEpochs = 0;
+        } else {
+            staleEpochs++;
+        }
+        if (criteria.patience > 0 && staleEpochs >= criteria.patience) {
+            why << "validation loss did not improve for " << staleEpochs << " epochs";
+            reason = why.str();
+            return true;
+        }
+    }
+
+    if (criteria.gradientTolerance > 0 && gradientNorm < criteria.gradientTolerance) {
+        why << "gradient norm " << gradientNorm << " below tolerance";
+        reason = why.str();
+        return true;
+    }
+
+    if (criteria.lossTolerance > 0 && !std::isnan(previousLoss) &&
+        std::fabs(previousLoss - trainingLoss) < criteria.lossTolerance) {
+        why << "loss change " << std::fabs(previousLoss - trainingLoss) << " below tolerance";
+        reason = why.str();
+        return true;
+    }
+    previousLoss = trainingLoss;
+    return false;
+}
+
+// Restore the snapshot taken at the best validation loss
+void EarlyStopping::restoreBest(Vector& weights, double& bias) const {
+    if (monitorValidation && bestEpoch >= 0) {
+        weights = bestWeights;
+        bias = bestBias;
+    }
+}
+
+bool EarlyStopping::needsTrainingLoss() const {
+    return criteria.lossTolerance > 0;
+}
+
+// Getters
+int EarlyStopping::getBestEpoch() const {
+    return bestEpoch;
+}
+
+double EarlyStopping::getBestValidationLoss() const {
+    return bestValidationLoss;
+}
+
+const std::string& EarlyStopping::getReason() const {
+    return reason;
+}
@@ -1,6 +1,8 @@
 #include "Evaluation.h"
+#include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <stdexcept>
 
 // Calculate accuracy
 double Evaluation::calculateAccuracy(const Vector& predictions, const Vector& actual) {
@@ -120,6 +122,52 @@ void Evaluation::displayConfusionMatrix(const Vector& predictions, const Vector&
     std::cout << "======================================\n" << std::endl;
 }
 
+// Multi-class confusion matrix: entry (actual, predicted) counts rows
+Matrix Evaluation::confusionMatrix(const Vector& predictions, const Vector& actual, int numClasses) {
+    if (predictions.getSize() != actual.getSize()) {
+        throw std::invalid_argument("Prediction and actual vectors must have same size");
+    }
+    
+    Matrix counts(numClasses, numClasses);
+    for (int i = 0; i < actual.getSize(); i++) {
+        if (!isClassIndex(actual[i], numClasses) || !isClassIndex(predictions[i], numClasses)) {
+            throw std::out_of_range("Class label outside [0, numClasses)");
+        }
+        counts.rowData(static_cast<int>(actual[i]))[static_cast<int>(predictions[i])] += 1.0;
+    }
+    return counts;
+}
+
+// Range and integrality are checked on the double; the comparisons are
+// false for NaN and numClasses bounds the value below INT_MAX
+bool Evaluation::isClassIndex(double value, int numClasses) {
+    return value >= 0 && value < numClasses && value == std::floor(value);
+}
+
+// Unweighted mean of the per-class F1 scores (classes absent from both
+// predictions and labels are skipped)
+double Evaluation::calculateMacroF1(const Vector& predictions, const Vector& actual, int numClasses) {
+    Matrix counts = confusionMatrix(predictions, actual, numClasses);
+    
+    double total = 0.0;
+    int present = 0;
+    for (int c = 0; c < numClasses; c++) {
+        double tp = counts.rowData(c)[c];
+        double actualCount = 0.0;
+        double predictedCount = 0.0;
+        for (int other = 0; other < numClasses; other++) {
+            actualCount += counts.rowData(c)[other];
+            predictedCount += counts.rowData(other)[c];
+        }
+        if (actualCount + predictedCount == 0) {
+            continue;
+        }
+        total += 2.0 * tp / (actualCount + predictedCount);
+        present++;
+    }
+    return (present > 0) ? total / present : 0.0;
+}
+
 // Analyze model (friend function)
 void Evaluation::analyzeModel(const LogisticRegression& model) {
     std::cout << "\n========== MODEL ANALYSIS ==========" << std::endl;
@@ -128,7 +176,9 @@ void Evaluation::analyzeModel(const LogisticRegression& model) {
     if (model.isTrained) {
         std::cout << "Model Status: Trained" << std::endl;
         std::cout << "Learning Rate: " << model.learningRate << std::endl;
-        std::cout << "Training Epochs: " << model.epochs << std::endl;
+        std::cout << "Epochs Run: " << model.epochsRun << " of " << model.epochs
+                  << (model.optimizer != nullptr ? " (optimizer iterations)" : "") << std::endl;
+        std::cout << "Data Passes: " << model.dataPasses << std::endl;
         std::cout << "Bias: " << model.bias << std::endl;
         
         std::cout << "\nFeature Weights:" << std::endl;
@@ -0,0 +1,293 @@
+#include "HyperparameterSearch.h"
+#include "Evaluation.h"
+#include "LogisticRegression.h"
+#include "Parallel.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+namespace {
+
+// Ranking: trials that reached a later rung first, then higher score, then
+// lower log-loss; failed trials last
+bool ranksBefore(const TrialResult& a, const TrialResult& b) {
+    if (a.error.empty() != b.error.empty()) {
+        return a.error.empty();
+    }
+    if (a.rungReached != b.rungReached) {
+        return a.rungReached > b.rungReached;
+    }
+    if (a.score != b.score) {
+        return a.score > b.score;
+    }
+    return a.logLoss < b.logLoss;
+}
+
+} // namespace
+
+// Constructor
+HyperparameterSearch::HyperparameterSearch(int numWorkers, int eta, int numRungs)
+    : workers(0), reductionFactor(3), rungs(3), metric(ACCURACY), seed(42) {
+    setWorkers(numWorkers);
+    setReductionFactor(eta);
+    setRungs(numRungs);
+}
+
+// Cartesian product of the value lists
+std::vector<HyperparameterConfig> HyperparameterSearch::grid(const std::vector<double>& learningRates,
+                                                             const std::vector<int>& epochs,
+                                                             const std::vector<int>& batchSizes) {
+    std::vector<HyperparameterConfig> configs;
+    for (double rate : learningRates) {
+        for (int count : epochs) {
+            for (int batch : batchSizes) {
+                HyperparameterConfig config;
+                config.learningRate = rate;
+                config.epochs = count;
+                config.batchSize = batch;
+                configs.push_back(config);
+            }
+        }
+    }
+    return configs;
+}
+
+// Seeded random sample of the search space
+std::vector<HyperparameterConfig> HyperparameterSearch::random(int count, double minRate, double maxRate,
+                                                               int minEpochs, int maxEpochs,
+                                                               const std::vector<int>& batchSizes,
+                                                               unsigned long seed) {
+    if (count < 0 || minRate <= 0 || maxRate < minRate || minEpochs < 1 || maxEpochs < minEpochs ||
+        batchSizes.empty()) {
+        throw std::invalid_argument("Random search needs 0 < minRate <= maxRate, 1 <= minEpochs <= maxEpochs "
+                                    "and at least one batch size");
+    }
+    std::mt19937_64 rng(seed);
+    std::uniform_real_distribution<double> logRate(std::log(minRate), std::log(maxRate));
+    std::uniform_int_distribution<int> epochCount(minEpochs, maxEpochs);
+    std::uniform_int_distribution<size_t> batchChoice(0, batchSizes.size() - 1);
+
+    std::vector<HyperparameterConfig> configs(count);
+    for (HyperparameterConfig& config : configs) {
+        config.learningRate = std::exp(logRate(rng));
+        config.epochs = epochCount(rng);
+        config.batchSize = batchSizes[batchChoice(rng)];
+    }
+    return configs;
+}
+
+// Worker pool: each thread takes the next untrained position until none are
+// left. Every trial writes only its own TrialResult and model
+void HyperparameterSearch::runRung(std::vector<TrialResult>& trials,
+                                   std::vector<std::unique_ptr<LogisticRegression>>& models,
+                                   const std::vector<int>& positions, double fraction, int rung,
+                                   const DataView& train, const DataView& validation) const {
+    Vector labels = validation.gatherLabels();
+    std::atomic<size_t> next(0);
+    // Trials running side by side share the cores instead of each using all
+    int poolSize = std::min(getWorkers(), static_cast<int>(positions.size()));
+    int budget = std::max(1, Parallel::getThreadCount() / std::max(1, poolSize));
+
+    auto work = [&]() {
+        for (size_t k = next++; k < positions.size(); k = next++) {
+            TrialResult& trial = trials[positions[k]];
+            std::unique_ptr<LogisticRegression>& model = models[positions[k]];
+            int epochs = std::max(1, static_cast<int>(std::lround(trial.config.epochs * fraction)));
+            try {
+                if (model == nullptr) {
+                    model = std::make_unique<LogisticRegression>(trial.config.learningRate, epochs);
+                    model->setBatchSize(trial.config.batchSize);
+                    model->setShuffleSeed(seed);
+                    model->setVerbose(false);
+                    model->setThreadBudget(budget);
+                    model->train(train);
+                } else {
+                    // Survivor of the previous rung: only the extra epochs
+                    model->setEpochs(epochs);
+                    model->setThreadBudget(budget);
+                    model->continueTraining(train);
+                }
+
+                Vector probabilities = model->predictProba(validation);
+                Vector predictions(probabilities.getSize());
+                for (int i = 0; i < probabilities.getSize(); i++) {
+                    predictions[i] = (probabilities[i] >= 0.5) ? 1.0 : 0.0;
+                }
+                trial.score = (metric == F1_SCORE) ? Evaluation::calculateF1Score(predictions, labels)
+                                                   : Evaluation::calculateAccuracy(predictions, labels);
+                trial.logLoss = LogisticRegression::logLoss(probabilities, validation);
+                trial.epochsTrained = epochs;
+                trial.rungReached = rung;
+            } catch (const std::exception& e) {
+                trial.error = e.what();
+                model.reset();
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < poolSize; t++) {
+        pool.emplace_back(work);
+    }
+    work();  // The calling thread is one of the workers
+    for (std::thread& thread : pool) {
+        thread.join();
+    }
+}
+
+// Successive halving over the candidate list
+SearchResult HyperparameterSearch::run(const std::vector<HyperparameterConfig>& configs,
+                                       const DataView& train, const DataView& validation) const {
+    if (configs.empty()) {
+        throw std::invalid_argument("Hyperparameter search needs at least one configuration");
+    }
+    if (!train.hasLabels() || !validation.hasLabels() || validation.getRows() == 0) {
+        throw std::invalid_argument("Training and validation views must be labelled and non-empty");
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    SearchResult result;
+    std::vector<TrialResult>& trials = result.trials;
+    trials.resize(configs.size());
+    std::vector<int> survivors(configs.size());
+    std::vector<std::unique_ptr<LogisticRegression>> models(configs.size());  // Kept between rungs
+    for (size_t i = 0; i < configs.size(); i++) {
+        trials[i].config = configs[i];
+        survivors[i] = static_cast<int>(i);
+        result.epochsFullGrid += configs[i].epochs;
+    }
+
+    std::cout << "\n========== HYPERPARAMETER SEARCH ==========" << std::endl;
+    std::cout << "Configurations: " << configs.size() << ", Workers: " << getWorkers()
+              << ", Rungs: " << rungs << ", Reduction factor: " << reductionFactor << std::endl;
+    std::cout << "Training rows: " << train.getRows() << ", Validation rows: " << validation.getRows() << std::endl;
+    std::cout << "===========================================\n" << std::endl;
+
+    for (int rung = 0; rung < rungs; rung++) {
+        bool last = (rung == rungs - 1) || survivors.size() <= 1;
+        double fraction = last ? 1.0 : std::pow(static_cast<double>(reductionFactor), rung - (rungs - 1));
+        std::vector<int> epochsBefore(configs.size());
+        for (int i : survivors) {
+            epochsBefore[i] = trials[i].epochsTrained;
+        }
+        runRung(trials, models, survivors, fraction, rung, train, validation);
+        result.rungs = rung + 1;
+
+        // Drop failed trials, rank the rest
+        survivors.erase(std::remove_if(survivors.begin(), survivors.end(),
+                                       [&](int i) { return !trials[i].error.empty(); }),
+                        survivors.end());
+        std::sort(survivors.begin(), survivors.end(),
+                  [&](int a, int b) { return ranksBefore(trials[a], trials[b]); });
+        for (int i : survivors) {
+            result.epochsUsed += trials[i].epochsTrained - epochsBefore[i];
+        }
+
+        std::cout << "Rung " << (rung + 1) << ": " << survivors.size() << " trained at "
+                  << std::fixed << std::setprecision(1) << (fraction * 100) << "% of their epochs";
+        if (!survivors.empty()) {
+            std::cout << ", best score " << std::setprecision(4) << trials[survivors.front()].score;
+        }
+        std::cout << std::endl;
+
+        if (last || survivors.empty()) {
+            break;
+        }
+        size_t keep = (survivors.size() + reductionFactor - 1) / reductionFactor;
+        keep = std::max<size_t>(1, keep);
+        for (size_t k = keep; k < survivors.size(); k++) {
+            models[survivors[k]].reset();  // Eliminated: free its weights
+        }
+        survivors.resize(keep);
+    }
+
+    std::sort(trials.begin(), trials.end(), ranksBefore);
+    result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Search completed in " << std::setprecision(2) << result.seconds << " s ("
+              << result.epochsUsed << " of " << result.epochsFullGrid << " epochs of a full search)"
+              << std::endl;
+    std::cout << "===========================================\n" << std::endl;
+    return result;
+}
+
+// Print the top trials
+void HyperparameterSearch::displayResults(const SearchResult& result, int top, std::ostream& os) {
+    std::ios::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << "\n========== SEARCH RESULTS ==========" << std::endl;
+    os << std::setw(6) << "rank" << std::setw(12) << "rate" << std::setw(8) << "epochs"
+       << std::setw(8) << "batch" << std::setw(7) << "rung" << std::setw(10) << "score"
+       << std::setw(10) << "log-loss" << std::endl;
+    int shown = std::min(top, static_cast<int>(result.trials.size()));
+    for (int r = 0; r < shown; r++) {
+        const TrialResult& trial = result.trials[r];
+        os << std::setw(6) << (r + 1) << std::setw(12) << std::setprecision(4) << std::defaultfloat
+           << trial.config.learningRate << std::setw(8) << trial.config.epochs
+           << std::setw(8) << trial.config.batchSize << std::setw(7) << (trial.rungReached + 1);
+        if (trial.error.empty()) {
+            os << std::fixed << std::setw(10) << trial.score << std::setw(10) << trial.logLoss << std::endl;
+        } else {
+            os << "  failed: " << trial.error << std::endl;
+        }
+    }
+    os << "====================================\n" << std::endl;
+    os.flags(flags);
+    os.precision(precision);
+}
+
+// Getters
+int HyperparameterSearch::getWorkers() const {
+    if (workers > 0) {
+        return workers;
+    }
+    unsigned int hardware = std::thread::hardware_concurrency();
+    return hardware > 0 ? static_cast<int>(hardware) : 1;
+}
+
+int HyperparameterSearch::getReductionFactor() const {
+    return reductionFactor;
+}
+
+int HyperparameterSearch::getRungs() const {
+    return rungs;
+}
+
+HyperparameterSearch::Metric HyperparameterSearch::getMetric() const {
+    return metric;
+}
+
+// Setters
+void HyperparameterSearch::setWorkers(int count) {
+    if (count < 0) {
+        throw std::invalid_argument("Worker count must be non-negative");
+    }
+    workers = count;
+}
+
+void HyperparameterSearch::setReductionFactor(int eta) {
+    if (eta < 2) {
+        throw std::invalid_argument("Reduction factor must be at least 2");
+    }
+    reductionFactor = eta;
+}
+
+void HyperparameterSearch::setRungs(int count) {
+    if (count < 1) {
+        throw std::invalid_argument("Search needs at least one rung");
+    }
+    rungs = count;
+}
+
+void HyperparameterSearch::setMetric(Metric validationMetric) {
+    metric = validationMetric;
+}
+
+void HyperparameterSearch::setSeed(unsigned long shuffleSeed) {
+    seed = shuffleSeed;
+}
@@ -0,0 +1,139 @@
+#include "LBFGSOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include <ostream>
+#include <vector>
+
+namespace {
+const double ARMIJO = 1e-4;         // Sufficient-decrease constant
+const int MAX_BACKTRACKS = 30;
+
+double dot(const Vector& a, const Vector& b) {
+    double sum = 0.0;
+    for (int i = 0; i < a.getSize(); i++) {
+        sum += a[i] * b[i];
+    }
+    return sum;
+}
+
+double maxAbs(const Vector& v) {
+    double result = 0.0;
+    for (int i = 0; i < v.getSize(); i++) {
+        result = std::max(result, std::fabs(v[i]));
+    }
+    return result;
+}
+}
+
+// Constructor
+LBFGSOptimizer::LBFGSOptimizer(int maxIter, double tol, int historySize)
+    : Optimizer(maxIter, tol), memory(std::max(1, historySize)) {}
+
+// Destructor
+LBFGSOptimizer::~LBFGSOptimizer() {}
+
+// Minimize with the two-loop recursion and Armijo backtracking
+int LBFGSOptimizer::minimize(LogisticObjective& objective, Vector& theta, std::ostream& log) const {
+    int n = objective.getNumParameters();
+    std::deque<Vector> sHistory;
+    std::deque<Vector> yHistory;
+    std::deque<double> rhoHistory;
+
+    Vector gradient;
+    double loss = objective.evaluate(theta, gradient);
+    int iterations = 0;
+
+    while (iterations < maxIterations && maxAbs(gradient) > tolerance) {
+        // Two-loop recursion: direction = -H * gradient
+        Vector direction(gradient);
+        int m = static_cast<int>(sHistory.size());
+        std::vector<double> alpha(m);
+        for (int k = m - 1; k >= 0; k--) {
+            alpha[k] = rhoHistory[k] * dot(sHistory[k], direction);
+            for (int i = 0; i < n; i++) {
+                direction[i] -= alpha[k] * yHistory[k][i];
+            }
+        }
+        double gamma = (m > 0) ? dot(sHistory[m - 1], yHistory[m - 1]) / dot(yHistory[m - 1], yHistory[m - 1]) : 1.0;
+        for (int i = 0; i < n; i++) {
+            direction[i] *= gamma;
+        }
+        for (int k = 0; k < m; k++) {
+            double beta = rhoHistory[k] * dot(yHistory[k], direction);
+            for (int i = 0; i < n; i++) {
+                direction[i] += sHistory[k][i] * (alpha[k] - beta);
+            }
+        }
+        for (int i = 0; i < n; i++) {
+            direction[i] = -direction[i];
+        }
+
+        // Fall back to steepest descent if curvature information misleads
+        double slope = dot(gradient, direction);
+        if (slope >= 0) {
+            sHistory.clear();
+            yHistory.clear();
+            rhoHistory.clear();
+            for (int i = 0; i < n; i++) {
+                direction[i] = -gradient[i];
+            }
+            slope = dot(gradient, direction);
+        }
+
+        // Backtracking line search; the first step is scaled to unit length
+        double step = (m == 0) ? std::min(1.0, 1.0 / std::sqrt(-slope)) : 1.0;
+        Vector candidate(n);
+        Vector candidateGradient;
+        double candidateLoss = loss;
+        bool accepted = false;
+        for (int attempt = 0; attempt < MAX_BACKTRACKS; attempt++) {
+            for (int i = 0; i < n; i++) {
+                candidate[i] = theta[i] + step * direction[i];
+            }
+            candidateLoss = objective.evaluate(candidate, candidateGradient);
+            if (candidateLoss <= loss + ARMIJO * step * slope) {
+                accepted = true;
+                break;
+            }
+            step *= 0.5;
+        }
+        if (!accepted) {
+            break;  // No further decrease possible at this precision
+        }
+
+        // Curvature pair; skipped when it would break positive definiteness
+        Vector s(n);
+        Vector y(n);
+        for (int i = 0; i < n; i++) {
+            s[i] = candidate[i] - theta[i];
+            y[i] = candidateGradient[i] - gradient[i];
+        }
+        double sy = dot(s, y);
+        if (sy > 1e-12) {
+            if (static_cast<int>(sHistory.size()) == memory) {
+                sHistory.pop_front();
+                yHistory.pop_front();
+                rhoHistory.pop_front();
+            }
+            sHistory.push_back(s);
+            yHistory.push_back(y);
+            rhoHistory.push_back(1.0 / sy);
+        }
+
+        theta = candidate;
+        gradient = candidateGradient;
+        loss = candidateLoss;
+        iterations++;
+
+        log << "Iteration " << std::setw(3) << iterations
+                  << " - Loss: " << std::fixed << std::setprecision(6) << loss
+                  << " (passes: " << objective.getDataPasses() << ")" << std::endl;
+    }
+    return iterations;
+}
+
+const char* LBFGSOptimizer::getName() const {
+    return "L-BFGS";
+}
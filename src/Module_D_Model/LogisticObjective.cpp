@@ -0,0 +1,151 @@
+#include "LogisticObjective.h"
+#include "Parallel.h"
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace {
+// log(1 + e^z) without overflow for large |z|
+double softplus(double z) {
+    return (z > 0) ? z + std::log1p(std::exp(-z)) : std::log1p(std::exp(z));
+}
+}
+
+// Constructor
+LogisticObjective::LogisticObjective(const DataView& trainingData, double l2Strength, int threadCap)
+    : data(trainingData), numParameters(trainingData.getCols() + 1), l2(l2Strength), dataPasses(0),
+      maxThreads(threadCap) {
+    if (!trainingData.hasLabels() || trainingData.getRows() == 0) {
+        throw std::invalid_argument("Objective needs non-empty labelled data");
+    }
+    if (l2Strength < 0 || threadCap < 0) {
+        throw std::invalid_argument("L2 strength and thread cap must be non-negative");
+    }
+}
+
+// Loss and gradient
+double LogisticObjective::evaluate(const Vector& theta, Vector& gradient) {
+    return accumulate(theta, gradient, nullptr);
+}
+
+// Loss, gradient and Hessian
+double LogisticObjective::evaluate(const Vector& theta, Vector& gradient, Matrix& hessian) {
+    return accumulate(theta, gradient, &hessian);
+}
+
+// One parallel pass: each block sums into its own buffer (loss, gradient and,
+// if requested, the upper triangle of the Hessian); buffers are then added in
+// block order and everything is divided by m
+double LogisticObjective::accumulate(const Vector& theta, Vector& gradient, Matrix* hessian) {
+    if (theta.getSize() != numParameters) {
+        throw std::invalid_argument("Parameter vector has the wrong size");
+    }
+
+    int numSamples = data.getRows();
+    int d = numParameters - 1;
+    int n = numParameters;
+    int blocks = Parallel::blockCount(numSamples, Parallel::ROWS_PER_BLOCK, maxThreads);
+    size_t stride = 1 + static_cast<size_t>(n) + (hessian != nullptr ? static_cast<size_t>(n) * n : 0);
+    std::vector<double> partial(stride * blocks, 0.0);
+    const double* t = theta.rawData();
+
+    Parallel::forRange(0, numSamples, Parallel::ROWS_PER_BLOCK, [&](int block, int begin, int end) {
+        double* buffer = partial.data() + stride * block;
+        double* g = buffer + 1;
+        double* h = buffer + 1 + n;
+        double loss = 0.0;
+        for (int i = begin; i < end; i++) {
+            const double* x = data.row(i);
+            double z = t[d];
+            for (int j = 0; j < d; j++) {
+                z += t[j] * x[j];
+            }
+            double label = data.getLabel(i);
+            double p = 1.0 / (1.0 + std::exp(-z));
+            double error = p - label;
+            loss += softplus(z) - label * z;
+
+            for (int j = 0; j < d; j++) {
+                g[j] += error * x[j];
+            }
+            g[d] += error;
+
+            if (hessian != nullptr) {
+                double weight = p * (1.0 - p);
+                for (int j = 0; j < d; j++) {
+                    double wx = weight * x[j];
+                    double* hj = h + static_cast<size_t>(j) * n;
+                    for (int k = j; k < d; k++) {
+                        hj[k] += wx * x[k];
+                    }
+                    hj[d] += wx;
+                }
+                h[static_cast<size_t>(d) * n + d] += weight;
+            }
+        }
+        buffer[0] = loss;
+    }, maxThreads);
+
+    double scale = 1.0 / numSamples;
+    double loss = 0.0;
+    gradient = Vector(n, 0.0);
+    if (hessian != nullptr) {
+        *hessian = Matrix(n, n);
+    }
+    for (int block = 0; block < blocks; block++) {
+        const double* buffer = partial.data() + stride * block;
+        loss += buffer[0];
+        for (int j = 0; j < n; j++) {
+            gradient[j] += buffer[1 + j];
+        }
+        if (hessian != nullptr) {
+            const double* h = buffer + 1 + n;
+            for (int j = 0; j < n; j++) {
+                double* row = hessian->rowData(j);
+                for (int k = j; k < n; k++) {
+                    row[k] += h[static_cast<size_t>(j) * n + k];
+                }
+            }
+        }
+    }
+
+    for (int j = 0; j < n; j++) {
+        gradient[j] *= scale;
+    }
+    if (hessian != nullptr) {
+        // Scale the upper triangle and mirror it
+        for (int j = 0; j < n; j++) {
+            double* row = hessian->rowData(j);
+            for (int k = j; k < n; k++) {
+                row[k] *= scale;
+                hessian->rowData(k)[j] = row[k];
+            }
+        }
+    }
+
+    // Ridge term on the weights only
+    loss *= scale;
+    for (int j = 0; j < d; j++) {
+        loss += 0.5 * l2 * t[j] * t[j];
+        gradient[j] += l2 * t[j];
+        if (hessian != nullptr) {
+            hessian->rowData(j)[j] += l2;
+        }
+    }
+
+    dataPasses++;
+    return loss;
+}
+
+// Getters
+int LogisticObjective::getNumParameters() const {
+    return numParameters;
+}
+
+int LogisticObjective::getNumSamples() const {
+    return data.getRows();
+}
+
+int LogisticObjective::getDataPasses() const {
+    return dataPasses;
+}
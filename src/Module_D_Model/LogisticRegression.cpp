@@ -1,19 +1,81 @@
 #include "LogisticRegression.h"
+#include "BatchPrefetcher.h"
+#include "LogisticObjective.h"
+#include "Parallel.h"
+#include "VectorMath.h"
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <iostream>
 #include <iomanip>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+// Fixed shard height used by the deterministic gradient reduction
+const int ROWS_PER_SHARD = 8192;
+// Fused-epoch tile: at most TILE_ROWS rows and about TILE_VALUES features
+// (16KB), so a tile is still in L1 when its error loop rereads it; scoring
+// runs its sigmoid per TILE_ROWS scores for the same reason
+const int TILE_ROWS = 256;
+const int TILE_VALUES = 2048;
+// Largest fraction of non-zero weights for which predictProba scores through
+// the active-feature list instead of the dense weight vector
+const double ACTIVE_SET_MAX_DENSITY = 0.5;
+// partialFit mini-batch height when no batch size is set
+const int ONLINE_BATCH_ROWS = 256;
+// Keeps the first AdaGrad steps finite while the squared-gradient sums are zero
+const double ADAGRAD_EPSILON = 1e-8;
+
+// Σ [y log p + (1 - y) log(1 - p)] over a view, p clipped to [1e-7, 1 - 1e-7]
+// to prevent log(0). Labels are 0/1, so each row needs one log: the clipped
+// probability of its own class is gathered and one vectorized log is taken.
+double logLikelihood(const double* probabilities, const DataView& data) {
+    size_t n = static_cast<size_t>(data.getRows());
+    std::vector<double> own(n);
+    for (size_t i = 0; i < n; i++) {
+        double p = std::min(std::max(probabilities[i], 1e-7), 1 - 1e-7);
+        double label = data.getLabel(static_cast<int>(i));
+        own[i] = label * p + (1 - label) * (1 - p);
+    }
+    VectorMath::log(own.data(), own.data(), n);
+    double sum = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        sum += own[i];
+    }
+    return sum;
+}
+}
 
 // Default constructor
 LogisticRegression::LogisticRegression() 
-    : bias(0.0), learningRate(0.01), epochs(1000), isTrained(false) {}
+    : bias(0.0), learningRate(0.01), epochs(1000), isTrained(false),
+      batchSize(0), shuffleSeed(42), schedule(CONSTANT), decay(0.0),
+      deterministicReduction(false), asynchronous(false), optimizer(nullptr), dataPasses(0),
+      validation(nullptr), epochsRun(0), biasSquaredGradient(0.0), partialFitRows(0),
+      partialFitCalls(0), scaledBias(0.0), threadBudget(0), verbose(true) {}
 
 // Parameterized constructor
 LogisticRegression::LogisticRegression(double lr, int numEpochs)
-    : bias(0.0), learningRate(lr), epochs(numEpochs), isTrained(false) {}
+    : bias(0.0), learningRate(lr), epochs(numEpochs), isTrained(false),
+      batchSize(0), shuffleSeed(42), schedule(CONSTANT), decay(0.0),
+      deterministicReduction(false), asynchronous(false), optimizer(nullptr), dataPasses(0),
+      validation(nullptr), epochsRun(0), biasSquaredGradient(0.0), partialFitRows(0),
+      partialFitCalls(0), scaledBias(0.0), threadBudget(0), verbose(true) {}
 
 // Destructor
 LogisticRegression::~LogisticRegression() {}
 
+// Training progress goes to std::cout, or nowhere when verbose is off. The
+// silent stream has no buffer and is per thread, so concurrent quiet
+// trainings share no stream state
+std::ostream& LogisticRegression::progress() const {
+    static thread_local std::ostream silent(nullptr);
+    return verbose ? std::cout : silent;
+}
+
 // Sigmoid activation function
 double LogisticRegression::sigmoid(double z) const {
     // Clip z to prevent overflow
@@ -24,131 +86,1078 @@ double LogisticRegression::sigmoid(double z) const {
 
 // Apply sigmoid to vector
 Vector LogisticRegression::sigmoidVector(const Vector& z) const {
-    Vector result(z.getSize());
-    for (int i = 0; i < z.getSize(); i++) {
-        result[i] = sigmoid(z[i]);
-    }
-    return result;
+    return VectorMath::sigmoid(z);
 }
 
 // Train the model using gradient descent
 void LogisticRegression::train(const Matrix& X, const Vector& y) {
+    if (X.getRows() != y.getSize()) {
+        throw std::invalid_argument("Number of samples must match labels");
+    }
+    train(DataView(X, y));
+}
+
+// Train on the rows selected by a view (e.g. a train split), without copying them
+void LogisticRegression::train(const DataView& data) {
+    checkTrainingData(data);
+    resetOnlineState();
+    fitEpochs(data, 0);
+}
+
+// Run epochs epochsRun .. epochs-1 from the current parameters: with the
+// same data and settings this ends exactly where train() with the larger
+// epoch count would (the shuffle and rate of each epoch depend only on its
+// number). Optimizer modes warm-start the solver instead
+void LogisticRegression::continueTraining(const DataView& data) {
+    if (!isTrained) {
+        throw std::runtime_error("Model must be trained before training can continue");
+    }
+    if (data.getCols() != weights.getSize()) {
+        throw std::invalid_argument("Number of features must match the model being updated");
+    }
+    checkTrainingData(data);
+    resetOnlineState();
+    fitEpochs(data, epochsRun);
+}
+
+// Checks shared by train and continueTraining, made before any output or
+// state change so an invalid run leaves no trace
+void LogisticRegression::checkTrainingData(const DataView& data) const {
+    if (!data.hasLabels()) {
+        throw std::invalid_argument("Training data must have labels");
+    }
+    if (validation != nullptr && validation->getCols() != data.getCols()) {
+        throw std::invalid_argument("Validation data must have as many features as the training data");
+    }
+    if (optimizer != nullptr && !regularizer.isSmooth()) {
+        throw std::invalid_argument("L1 penalties need a gradient-descent mode (proximal step); "
+                                    "use L2 with an optimizer");
+    }
+}
+
+// Dispatch to the dense training mode, starting at firstEpoch (0 = from
+// zero weights)
+void LogisticRegression::fitEpochs(const DataView& data, int firstEpoch) {
+    if (optimizer != nullptr) {
+        trainWithOptimizer(data, firstEpoch);
+    } else if (batchSize > 0 && batchSize < data.getRows()) {
+        trainMiniBatch(data, firstEpoch);
+    } else {
+        trainFullBatch(data, firstEpoch);
+    }
+}
+
+// Full-batch gradient descent epochs
+void LogisticRegression::trainFullBatch(const DataView& data, int firstEpoch) {
+    int numSamples = data.getRows();
+    int numFeatures = data.getCols();
+    
+    // Initialize weights
+    if (firstEpoch == 0) {
+        weights = Vector(numFeatures, 0.0);
+        bias = 0.0;
+    }
+    
+    progress() << "\n========== TRAINING LOGISTIC REGRESSION ==========" << std::endl;
+    progress() << "Samples: " << numSamples << ", Features: " << numFeatures << std::endl;
+    progress() << "Learning Rate: " << learningRate << ", Epochs: " << epochs << std::endl;
+    if (firstEpoch > 0) {
+        progress() << "Continuing from epoch " << (firstEpoch + 1) << std::endl;
+    }
+    progress() << "==================================================\n" << std::endl;
+    
+    // Gradient descent, stopping early when a criterion is met. Buffers are
+    // allocated once; every epoch is a single fused pass over the rows
+    EarlyStopping monitor(stopping, monitorsValidation());
+    Vector dw(numFeatures, 0.0);
+    Vector previous(numFeatures, 0.0);
+    std::vector<double> scratch;
+    epochsRun = firstEpoch;
+    for (int epoch = firstEpoch; epoch < epochs; epoch++) {
+        // Forward pass, gradient and (when printed or monitored) loss together
+        bool report = (epoch + 1) % 100 == 0 || epoch == 0;
+        double likelihood = 0.0;
+        bool needLoss = report || monitor.needsTrainingLoss();
+        double db = accumulateGradient(data, dw, scratch, needLoss ? &likelihood : nullptr);
+        
+        // Loss (binary cross-entropy plus penalty) of the parameters before this update
+        double loss = needLoss ? -likelihood / numSamples + regularizer.penalty(weights) : 0.0;
+        
+        // Update weights and bias: gradient step on the smooth part, then the L1 prox
+        double rate = getLearningRateAt(epoch);
+        double* w = weights.rawData();
+        double* g = dw.rawData();
+        std::copy(w, w + numFeatures, previous.rawData());
+        for (int j = 0; j < numFeatures; j++) {
+            g[j] /= numSamples;
+        }
+        regularizer.addGradient(w, g, numFeatures);
+        for (int j = 0; j < numFeatures; j++) {
+            w[j] -= rate * g[j];
+        }
+        regularizer.proximalStep(w, numFeatures, rate);
+        bias -= rate * (db / numSamples);
+        
+        // Norm of the (proximal) gradient mapping (previous - w) / rate; it is
+        // the plain gradient norm when there is no L1 part
+        double gradientNorm = (db / numSamples) * (db / numSamples);
+        for (int j = 0; j < numFeatures; j++) {
+            double step = (rate > 0) ? (previous[j] - w[j]) / rate : g[j];
+            gradientNorm += step * step;
+        }
+        gradientNorm = std::sqrt(gradientNorm);
+        
+        // Print progress every 100 epochs
+        if (report) {
+            progress() << "Epoch " << std::setw(4) << (epoch + 1) 
+                      << " - Loss: " << std::fixed << std::setprecision(4) << loss << std::endl;
+        }
+        
+        epochsRun = epoch + 1;
+        double validationLoss = monitorsValidation() ? meanLoss(*validation) : 0.0;
+        if (monitor.update(epoch, loss, gradientNorm, validationLoss, weights, bias)) {
+            progress() << "Early stopping after epoch " << epochsRun << ": " << monitor.getReason() << std::endl;
+            break;
+        }
+    }
+    finishEarlyStopping(monitor);
+    
+    dataPasses = epochsRun - firstEpoch;
+    refreshActiveSet();
+    isTrained = true;
+    progress() << "\nTraining completed!" << std::endl;
+    progress() << "==================================================\n" << std::endl;
+}
+
+// Full-batch gradient descent on CSR rows: each epoch touches only the
+// stored entries, so the cost is O(non-zeros) plus one pass over the weights
+void LogisticRegression::train(const SparseMatrix& X, const Vector& y) {
     int numSamples = X.getRows();
     int numFeatures = X.getCols();
     
     if (numSamples != y.getSize()) {
         throw std::invalid_argument("Number of samples must match labels");
     }
+    if (numSamples == 0) {
+        throw std::invalid_argument("Cannot train on empty data");
+    }
+    resetOnlineState();
+    
+    if (batchSize > 0 && batchSize < numSamples) {
+        trainSparseSGD(X, y);
+        return;
+    }
     
-    // Initialize weights
     weights = Vector(numFeatures, 0.0);
     bias = 0.0;
     
-    std::cout << "\n========== TRAINING LOGISTIC REGRESSION ==========" << std::endl;
-    std::cout << "Samples: " << numSamples << ", Features: " << numFeatures << std::endl;
-    std::cout << "Learning Rate: " << learningRate << ", Epochs: " << epochs << std::endl;
-    std::cout << "==================================================\n" << std::endl;
+    progress() << "\n========== TRAINING LOGISTIC REGRESSION (SPARSE) ==========" << std::endl;
+    progress() << "Samples: " << numSamples << ", Features: " << numFeatures
+              << ", Non-zeros: " << X.getNonZeros() << std::endl;
+    progress() << "Learning Rate: " << learningRate << ", Epochs: " << epochs << std::endl;
+    progress() << "===========================================================\n" << std::endl;
+    
+    const int* indices = X.getIndices();
+    const double* values = X.getValues();
+    double* w = weights.rawData();
+    Vector dw(numFeatures, 0.0);
+    double* g = dw.rawData();
     
-    // Gradient descent
     for (int epoch = 0; epoch < epochs; epoch++) {
-        // Forward pass: compute predictions
-        Vector predictions(numSamples);
-        for (int i = 0; i < numSamples; i++) {
-            double z = bias;
-            for (int j = 0; j < numFeatures; j++) {
-                z += weights[j] * X.getValue(i, j);
-            }
-            predictions[i] = sigmoid(z);
-        }
-        
-        // Compute gradients
-        Vector dw(numFeatures, 0.0);
+        std::fill(g, g + numFeatures, 0.0);
         double db = 0.0;
+        double loss = 0.0;
         
         for (int i = 0; i < numSamples; i++) {
-            double error = predictions[i] - y[i];
+            double p = sigmoid(bias + X.dotRow(i, w));
+            double label = y[i];
+            double error = p - label;
             db += error;
-            for (int j = 0; j < numFeatures; j++) {
-                dw[j] += error * X.getValue(i, j);
+            for (long long k = X.rowStart(i); k < X.rowEnd(i); k++) {
+                g[indices[k]] += error * values[k];
             }
+            
+            // Clip to prevent log(0)
+            if (p < 1e-7) p = 1e-7;
+            if (p > 1 - 1e-7) p = 1 - 1e-7;
+            loss += label * std::log(p) + (1 - label) * std::log(1 - p);
         }
         
-        // Update weights and bias
-        for (int j = 0; j < numFeatures; j++) {
-            weights[j] -= learningRate * (dw[j] / numSamples);
+        // Print progress every 100 epochs (penalty of the pre-update weights)
+        if ((epoch + 1) % 100 == 0 || epoch == 0) {
+            progress() << "Epoch " << std::setw(4) << (epoch + 1)
+                      << " - Loss: " << std::fixed << std::setprecision(4)
+                      << (-loss / numSamples + regularizer.penalty(w, numFeatures)) << std::endl;
         }
-        bias -= learningRate * (db / numSamples);
         
-        // Print progress every 100 epochs
-        if ((epoch + 1) % 100 == 0 || epoch == 0) {
-            // Compute loss (binary cross-entropy)
-            double loss = 0.0;
-            for (int i = 0; i < numSamples; i++) {
-                double p = predictions[i];
-                // Clip to prevent log(0)
-                if (p < 1e-7) p = 1e-7;
-                if (p > 1 - 1e-7) p = 1 - 1e-7;
-                loss += y[i] * std::log(p) + (1 - y[i]) * std::log(1 - p);
-            }
-            loss = -loss / numSamples;
-            
-            std::cout << "Epoch " << std::setw(4) << (epoch + 1) 
-                      << " - Loss: " << std::fixed << std::setprecision(4) << loss << std::endl;
+        double rate = getLearningRateAt(epoch);
+        for (int j = 0; j < numFeatures; j++) {
+            g[j] /= numSamples;
         }
+        regularizer.addGradient(w, g, numFeatures);
+        for (int j = 0; j < numFeatures; j++) {
+            w[j] -= rate * g[j];
+        }
+        regularizer.proximalStep(w, numFeatures, rate);
+        bias -= rate * (db / numSamples);
     }
     
+    dataPasses = epochs;
+    epochsRun = epochs;
+    refreshActiveSet();
     isTrained = true;
-    std::cout << "\nTraining completed!" << std::endl;
-    std::cout << "==================================================\n" << std::endl;
+    progress() << "\nTraining completed!" << std::endl;
+    progress() << "===========================================================\n" << std::endl;
 }
 
-// Make predictions
-Vector LogisticRegression::predict(const Matrix& X) {
-    if (!isTrained) {
-        throw std::runtime_error("Model must be trained before prediction");
+// Hand the whole problem to the configured solver; parameters start at zero
+void LogisticRegression::trainWithOptimizer(const DataView& data, int firstEpoch) {
+    int numFeatures = data.getCols();
+    
+    progress() << "\n========== TRAINING LOGISTIC REGRESSION (" << optimizer->getName() << ") ==========" << std::endl;
+    progress() << "Samples: " << data.getRows() << ", Features: " << numFeatures << std::endl;
+    progress() << "Max iterations: " << optimizer->getMaxIterations()
+              << ", Tolerance: " << std::scientific << optimizer->getTolerance()
+              << std::fixed << std::endl;
+    progress() << "==================================================\n" << std::endl;
+    
+    LogisticObjective objective(data, regularizer.getL2(), threadBudget);
+    Vector theta(numFeatures + 1, 0.0);
+    if (firstEpoch > 0) {
+        // Warm start from the current parameters
+        for (int j = 0; j < numFeatures; j++) {
+            theta[j] = weights[j];
+        }
+        theta[numFeatures] = bias;
     }
+    int iterations = optimizer->minimize(objective, theta, progress());
     
+    weights = Vector(numFeatures);
+    for (int j = 0; j < numFeatures; j++) {
+        weights[j] = theta[j];
+    }
+    bias = theta[numFeatures];
+    dataPasses = objective.getDataPasses();
+    epochsRun = firstEpoch + iterations;
+    refreshActiveSet();
+    isTrained = true;
+    
+    progress() << "\nTraining completed in " << iterations << " iterations ("
+              << dataPasses << " data passes)" << std::endl;
+    progress() << "==================================================\n" << std::endl;
+}
+
+// Mean log-loss of the current parameters on a labelled view
+double LogisticRegression::meanLoss(const DataView& data) const {
+    std::vector<double> probabilities(data.getRows());
+    computeProbabilities(data, probabilities.data());
+    return -logLikelihood(probabilities.data(), data) / std::max(1, data.getRows());
+}
+
+// Mean log-loss of given probabilities, clipped exactly like training
+double LogisticRegression::logLoss(const Vector& probabilities, const DataView& data) {
+    if (!data.hasLabels() || probabilities.getSize() != data.getRows()) {
+        throw std::invalid_argument("Log-loss needs one probability per labelled row");
+    }
+    return -logLikelihood(probabilities.rawData(), data) / std::max(1, data.getRows());
+}
+
+// Thread budget, or the process-wide count when none is set
+int LogisticRegression::threadsToUse() const {
+    int threads = Parallel::getThreadCount();
+    return (threadBudget > 0) ? std::min(threads, threadBudget) : threads;
+}
+
+// Linear scores for a tile of rows, then one vectorized sigmoid over the
+// tile while its scores are still in L1; blocks run in parallel
+void LogisticRegression::computeProbabilities(const DataView& data, double* out) const {
+    int numFeatures = data.getCols();
+    const double* w = weights.rawData();
+    double b = bias;
+    Parallel::forRange(0, data.getRows(), Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        for (int tile = begin; tile < end; tile += TILE_ROWS) {
+            int tileEnd = std::min(end, tile + TILE_ROWS);
+            for (int i = tile; i < tileEnd; i++) {
+                const double* x = data.row(i);
+                double z = b;
+                for (int j = 0; j < numFeatures; j++) {
+                    z += w[j] * x[j];
+                }
+                out[i] = z;
+            }
+            VectorMath::sigmoid(out + tile, out + tile, static_cast<size_t>(tileEnd - tile));
+        }
+    }, threadBudget);
+}
+
+// Validation rows cost a scoring pass per epoch; only patience needs them
+bool LogisticRegression::monitorsValidation() const {
+    return validation != nullptr && stopping.patience > 0;
+}
+
+// Put back the best validated parameters, if validation was monitored
+void LogisticRegression::finishEarlyStopping(const EarlyStopping& monitor) {
+    if (monitorsValidation() && monitor.getBestEpoch() >= 0) {
+        monitor.restoreBest(weights, bias);
+        progress() << "Restored weights from epoch " << (monitor.getBestEpoch() + 1)
+                  << " (validation loss " << std::fixed << std::setprecision(4)
+                  << monitor.getBestValidationLoss() << ")" << std::endl;
+    }
+}
+
+// One fused pass over the view: for every row z, sigmoid, the error p - y,
+// its gradient contribution and (when logLikelihood is non-null) its loss
+// term. Rows are processed in tiles small enough to stay in L1, so X is
+// streamed from memory once; each tile's scores go through one vectorized
+// sigmoid before its error loop rereads the cached rows.
+// Rows are cut into shards, each shard sums into its own slice of scratch,
+// and the slices are added in shard order. Shards follow the thread blocks
+// by default; with deterministicReduction they have a fixed size, so the
+// result is bitwise identical for any thread count.
+// Writes X^T (p - y) into dw and returns sum(p - y).
+double LogisticRegression::accumulateGradient(const DataView& data, Vector& dw,
+                                              std::vector<double>& scratch,
+                                              double* logLikelihood) const {
+    int numSamples = data.getRows();
+    int numFeatures = data.getCols();
+    int shards = deterministicReduction
+        ? (numSamples + ROWS_PER_SHARD - 1) / ROWS_PER_SHARD
+        : Parallel::blockCount(numSamples, Parallel::ROWS_PER_BLOCK, threadBudget);
+    int stride = numFeatures + 2;  // Gradient, then sum(p - y), then loss
+    int tileRows = std::max(1, std::min(TILE_ROWS, TILE_VALUES / std::max(1, numFeatures)));
+    
+    scratch.assign(static_cast<size_t>(shards) * stride, 0.0);
+    const double* w = weights.rawData();
+    double b = bias;
+    
+    Parallel::forRange(0, shards, 1, [&](int, int firstShard, int lastShard) {
+        double p[TILE_ROWS];
+        for (int shard = firstShard; shard < lastShard; shard++) {
+            int begin = static_cast<int>(static_cast<long long>(numSamples) * shard / shards);
+            int end = static_cast<int>(static_cast<long long>(numSamples) * (shard + 1) / shards);
+            double* g = scratch.data() + static_cast<size_t>(shard) * stride;
+            double gb = 0.0;
+            double ll = 0.0;
+            for (int tile = begin; tile < end; tile += tileRows) {
+                int count = std::min(tileRows, end - tile);
+                for (int t = 0; t < count; t++) {
+                    const double* x = data.row(tile + t);
+                    double z = b;
+                    for (int j = 0; j < numFeatures; j++) {
+                        z += w[j] * x[j];
+                    }
+                    p[t] = z;
+                }
+                VectorMath::sigmoid(p, p, static_cast<size_t>(count));
+                
+                for (int t = 0; t < count; t++) {
+                    const double* x = data.row(tile + t);
+                    double error = p[t] - data.getLabel(tile + t);
+                    gb += error;
+                    for (int j = 0; j < numFeatures; j++) {
+                        g[j] += error * x[j];
+                    }
+                }
+                
+                if (logLikelihood != nullptr) {
+                    // Clipped probability of each row's own class, one log per row
+                    for (int t = 0; t < count; t++) {
+                        double q = std::min(std::max(p[t], 1e-7), 1 - 1e-7);
+                        double label = data.getLabel(tile + t);
+                        p[t] = label * q + (1 - label) * (1 - q);
+                    }
+                    VectorMath::log(p, p, static_cast<size_t>(count));
+                    for (int t = 0; t < count; t++) {
+                        ll += p[t];
+                    }
+                }
+            }
+            g[numFeatures] = gb;
+            g[numFeatures + 1] = ll;
+        }
+    }, threadBudget);
+    
+    double db = 0.0;
+    double ll = 0.0;
+    double* out = dw.rawData();
+    std::fill(out, out + numFeatures, 0.0);
+    for (int shard = 0; shard < shards; shard++) {
+        const double* g = scratch.data() + static_cast<size_t>(shard) * stride;
+        for (int j = 0; j < numFeatures; j++) {
+            out[j] += g[j];
+        }
+        db += g[numFeatures];
+        ll += g[numFeatures + 1];
+    }
+    if (logLikelihood != nullptr) {
+        *logLikelihood = ll;
+    }
+    return db;
+}
+
+// Mini-batch SGD: every epoch shuffles the row order with a seed derived
+// from shuffleSeed and the epoch, then updates after each batchSize rows
+void LogisticRegression::trainMiniBatch(const DataView& data, int firstEpoch) {
+    int numSamples = data.getRows();
+    int numFeatures = data.getCols();
+    
+    if (firstEpoch == 0) {
+        weights = Vector(numFeatures, 0.0);
+        bias = 0.0;
+    }
+    
+    progress() << "\n========== TRAINING LOGISTIC REGRESSION (MINI-BATCH SGD) ==========" << std::endl;
+    progress() << "Samples: " << numSamples << ", Features: " << numFeatures
+              << ", Batch size: " << batchSize << std::endl;
+    progress() << "Learning Rate: " << learningRate << ", Epochs: " << epochs << std::endl;
+    if (firstEpoch > 0) {
+        progress() << "Continuing from epoch " << (firstEpoch + 1) << std::endl;
+    }
+    progress() << "===================================================================\n" << std::endl;
+    
+    std::vector<int> order(numSamples);
+    for (int i = 0; i < numSamples; i++) {
+        order[i] = i;
+    }
+    // Each shuffle permutes the previous order, so a continued run replays
+    // the earlier shuffles (no gradient work) to reach the same sequence
+    for (int epoch = 0; epoch < firstEpoch; epoch++) {
+        DataView::shuffleIndices(order, shuffleSeed + static_cast<unsigned long>(epoch));
+    }
+    int reportEvery = std::max(1, epochs / 10);
+    EarlyStopping monitor(stopping, monitorsValidation());
+    epochsRun = firstEpoch;
+    Vector dw(numFeatures, 0.0);  // Gradient scratch shared by every batch
+    
+    for (int epoch = firstEpoch; epoch < epochs; epoch++) {
+        DataView::shuffleIndices(order, shuffleSeed + static_cast<unsigned long>(epoch));
+        double rate = getLearningRateAt(epoch);
+        double epochLoss = 0.0;
+        
+        for (int begin = 0; begin < numSamples; begin += batchSize) {
+            int count = std::min(batchSize, numSamples - begin);
+            epochLoss += gradientStep(data, order.data() + begin, count, rate, dw) * count;
+        }
+        
+        // Mean loss seen during the epoch (each batch measured before its update)
+        if ((epoch + 1) % reportEvery == 0 || epoch == 0) {
+            progress() << "Epoch " << std::setw(4) << (epoch + 1)
+                      << " - Loss: " << std::fixed << std::setprecision(4)
+                      << (epochLoss / numSamples) << std::endl;
+        }
+        
+        // No full gradient is formed here, so the gradient-norm criterion is inert
+        epochsRun = epoch + 1;
+        double validationLoss = monitorsValidation() ? meanLoss(*validation) : 0.0;
+        if (monitor.update(epoch, epochLoss / numSamples, std::numeric_limits<double>::infinity(),
+                           validationLoss, weights, bias)) {
+            progress() << "Early stopping after epoch " << epochsRun << ": " << monitor.getReason() << std::endl;
+            break;
+        }
+    }
+    finishEarlyStopping(monitor);
+    
+    dataPasses = epochsRun - firstEpoch;
+    refreshActiveSet();
+    isTrained = true;
+    progress() << "\nTraining completed!" << std::endl;
+    progress() << "===================================================================\n" << std::endl;
+}
+
+// Mini-batch SGD over CSR rows. Synchronous: the batch's errors are computed
+// from the current weights, split across threads in blocks of at least
+// SPARSE_ROWS_PER_BLOCK rows, then applied in one serial scatter.
+// Asynchronous (Hogwild): every thread runs SGD over its own slice of the
+// shuffled order and writes the shared weights with relaxed atomic
+// loads/stores and no locks. Concurrent updates to the same weight may be
+// lost; with sparse rows they rarely overlap, and SGD tolerates it.
+void LogisticRegression::trainSparseSGD(const SparseMatrix& X, const Vector& y) {
     int numSamples = X.getRows();
     int numFeatures = X.getCols();
+    const int* indices = X.getIndices();
+    const double* values = X.getValues();
     
-    if (numFeatures != weights.getSize()) {
-        throw std::invalid_argument("Number of features must match trained model");
+    progress() << "\n========== TRAINING LOGISTIC REGRESSION (SPARSE "
+              << (asynchronous ? "HOGWILD" : "MINI-BATCH") << " SGD) ==========" << std::endl;
+    progress() << "Samples: " << numSamples << ", Features: " << numFeatures
+              << ", Non-zeros: " << X.getNonZeros() << ", Batch size: " << batchSize << std::endl;
+    progress() << "Learning Rate: " << learningRate << ", Epochs: " << epochs
+              << ", Threads: " << threadsToUse() << std::endl;
+    progress() << "================================================================\n" << std::endl;
+    
+    // Shared parameters; relaxed atomics compile to plain loads/stores
+    std::vector<std::atomic<double>> w(numFeatures);
+    for (std::atomic<double>& value : w) {
+        value.store(0.0, std::memory_order_relaxed);
     }
+    std::atomic<double> b(0.0);
     
-    Vector predictions(numSamples);
+    // Forward pass for one row against the shared weights
+    auto score = [&](int i) {
+        double z = b.load(std::memory_order_relaxed);
+        for (long long k = X.rowStart(i); k < X.rowEnd(i); k++) {
+            z += values[k] * w[indices[k]].load(std::memory_order_relaxed);
+        }
+        return sigmoid(z);
+    };
+    auto rowLoss = [](double p, double label) {
+        // Clip to prevent log(0)
+        if (p < 1e-7) p = 1e-7;
+        if (p > 1 - 1e-7) p = 1 - 1e-7;
+        return label * std::log(p) + (1 - label) * std::log(1 - p);
+    };
+    // Apply -scale * error * x_i for each row of a batch
+    auto applyBatch = [&](const int* rows, const double* errors, int count, double rate) {
+        double step = rate / count;
+        double db = 0.0;
+        for (int k = 0; k < count; k++) {
+            int i = rows[k];
+            double delta = step * errors[k];
+            db += errors[k];
+            for (long long e = X.rowStart(i); e < X.rowEnd(i); e++) {
+                std::atomic<double>& weight = w[indices[e]];
+                weight.store(weight.load(std::memory_order_relaxed) - delta * values[e],
+                             std::memory_order_relaxed);
+            }
+        }
+        b.store(b.load(std::memory_order_relaxed) - step * db, std::memory_order_relaxed);
+    };
     
+    std::vector<int> order(numSamples);
     for (int i = 0; i < numSamples; i++) {
+        order[i] = i;
+    }
+    std::vector<double> errors(numSamples);
+    int reportEvery = std::max(1, epochs / 10);
+    // Thread count fixed for the whole fit, so blockLoss always has a slot
+    // for every block
+    int threads = threadsToUse();
+    std::vector<double> blockLoss(threads, 0.0);
+    
+    for (int epoch = 0; epoch < epochs; epoch++) {
+        DataView::shuffleIndices(order, shuffleSeed + static_cast<unsigned long>(epoch));
+        double rate = getLearningRateAt(epoch);
+        double epochLoss = 0.0;
+        
+        if (asynchronous) {
+            int blocks = Parallel::blockCount(numSamples, batchSize, threads);
+            Parallel::forRange(0, numSamples, batchSize, [&](int block, int begin, int end) {
+                double loss = 0.0;
+                for (int start = begin; start < end; start += batchSize) {
+                    int count = std::min(batchSize, end - start);
+                    for (int k = 0; k < count; k++) {
+                        int i = order[start + k];
+                        double p = score(i);
+                        errors[start + k] = p - y[i];
+                        loss += rowLoss(p, y[i]);
+                    }
+                    applyBatch(order.data() + start, errors.data() + start, count, rate);
+                }
+                blockLoss[block] = loss;
+            }, threads);
+            for (int block = 0; block < blocks; block++) {
+                epochLoss += blockLoss[block];
+            }
+        } else {
+            for (int start = 0; start < numSamples; start += batchSize) {
+                int count = std::min(batchSize, numSamples - start);
+                int blocks = Parallel::blockCount(count, SPARSE_ROWS_PER_BLOCK, threads);
+                Parallel::forRange(0, count, SPARSE_ROWS_PER_BLOCK, [&](int block, int begin, int end) {
+                    double loss = 0.0;
+                    for (int k = begin; k < end; k++) {
+                        int i = order[start + k];
+                        double p = score(i);
+                        errors[start + k] = p - y[i];
+                        loss += rowLoss(p, y[i]);
+                    }
+                    blockLoss[block] = loss;
+                }, threads);
+                applyBatch(order.data() + start, errors.data() + start, count, rate);
+                for (int block = 0; block < blocks; block++) {
+                    epochLoss += blockLoss[block];
+                }
+            }
+        }
+        
+        // Mean loss seen during the epoch (each row measured before its update)
+        if ((epoch + 1) % reportEvery == 0 || epoch == 0) {
+            progress() << "Epoch " << std::setw(4) << (epoch + 1)
+                      << " - Loss: " << std::fixed << std::setprecision(4)
+                      << (-epochLoss / numSamples) << std::endl;
+        }
+        
+        // Penalty applied lazily once per epoch (the threads have joined):
+        // the epoch's B per-batch steps collapse into one L2 decay by
+        // (1 - rate λ2)^B and one soft-threshold by B rate λ1, so batches
+        // keep touching only their rows' non-zeros
+        if (regularizer.isActive()) {
+            int numBatches = (numSamples + batchSize - 1) / batchSize;
+            double decayFactor = std::pow(std::max(0.0, 1.0 - rate * regularizer.getL2()), numBatches);
+            double threshold = numBatches * rate * regularizer.getL1();
+            for (int j = 0; j < numFeatures; j++) {
+                double value = w[j].load(std::memory_order_relaxed) * decayFactor;
+                value = std::copysign(std::max(std::fabs(value) - threshold, 0.0), value);
+                w[j].store(value, std::memory_order_relaxed);
+            }
+        }
+    }
+    
+    weights = Vector(numFeatures);
+    for (int j = 0; j < numFeatures; j++) {
+        weights[j] = w[j].load(std::memory_order_relaxed);
+    }
+    bias = b.load(std::memory_order_relaxed);
+    
+    dataPasses = epochs;
+    epochsRun = epochs;
+    refreshActiveSet();
+    isTrained = true;
+    progress() << "\nTraining completed!" << std::endl;
+    progress() << "================================================================\n" << std::endl;
+}
+
+// One gradient descent update on selected rows; returns their mean loss
+// computed from the same forward pass
+double LogisticRegression::gradientStep(const DataView& data, const int* order, int count, double rate,
+                                        Vector& dw) {
+    int numFeatures = data.getCols();
+    
+    double db = 0.0;
+    double* w = weights.rawData();
+    double* g = dw.rawData();
+    std::fill(g, g + numFeatures, 0.0);
+    double loss = batchGradient(data, order, count, g, db);
+    
+    double penalty = regularizer.penalty(w, numFeatures);
+    for (int j = 0; j < numFeatures; j++) {
+        g[j] /= count;
+    }
+    regularizer.addGradient(w, g, numFeatures);
+    for (int j = 0; j < numFeatures; j++) {
+        w[j] -= rate * g[j];
+    }
+    regularizer.proximalStep(w, numFeatures, rate);
+    bias -= rate * (db / count);
+    
+    return -loss / count + penalty;
+}
+
+// Forward pass and gradient of rows order[0..count) (0..count when order is null)
+double LogisticRegression::batchGradient(const DataView& data, const int* order, int count,
+                                         double* g, double& db) const {
+    int numFeatures = data.getCols();
+    const double* w = weights.rawData();
+    double loss = 0.0;
+    
+    for (int k = 0; k < count; k++) {
+        int i = (order != nullptr) ? order[k] : k;
+        const double* x = data.row(i);
         double z = bias;
         for (int j = 0; j < numFeatures; j++) {
-            z += weights[j] * X.getValue(i, j);
+            z += w[j] * x[j];
         }
-        double prob = sigmoid(z);
-        predictions[i] = (prob >= 0.5) ? 1.0 : 0.0;  // Threshold at 0.5
+        double p = sigmoid(z);
+        double label = data.getLabel(i);
+        double error = p - label;
+        
+        db += error;
+        for (int j = 0; j < numFeatures; j++) {
+            g[j] += error * x[j];
+        }
+        
+        // Clip to prevent log(0)
+        if (p < 1e-7) p = 1e-7;
+        if (p > 1 - 1e-7) p = 1 - 1e-7;
+        loss += label * std::log(p) + (1 - label) * std::log(1 - p);
+    }
+    return loss;
+}
+
+// AdaGrad update: accumulate squared gradients, then step each weight by
+// learningRate / sqrt(its sum); the L1 prox uses the same per-weight step
+double LogisticRegression::adaptiveStep(const DataView& data, const int* order, int count, Vector& dw) {
+    int numFeatures = data.getCols();
+    
+    double db = 0.0;
+    double* w = weights.rawData();
+    double* g = dw.rawData();
+    std::fill(g, g + numFeatures, 0.0);
+    double loss = batchGradient(data, order, count, g, db);
+    
+    double penalty = regularizer.penalty(w, numFeatures);
+    for (int j = 0; j < numFeatures; j++) {
+        g[j] /= count;
+    }
+    regularizer.addGradient(w, g, numFeatures);
+    
+    double* squares = squaredGradients.rawData();
+    bool proximal = !regularizer.isSmooth();
+    for (int j = 0; j < numFeatures; j++) {
+        squares[j] += g[j] * g[j];
+        double step = learningRate / (std::sqrt(squares[j]) + ADAGRAD_EPSILON);
+        w[j] -= step * g[j];
+        if (proximal) {
+            regularizer.proximalStep(w + j, 1, step);
+        }
+    }
+    db /= count;
+    biasSquaredGradient += db * db;
+    bias -= learningRate / (std::sqrt(biasSquaredGradient) + ADAGRAD_EPSILON) * db;
+    
+    return -loss / count + penalty;
+}
+
+// Continue training on new rows only; weights, bias and the AdaGrad sums
+// carry over from earlier calls (or from train())
+void LogisticRegression::partialFit(const DataView& data) {
+    int numSamples = data.getRows();
+    int numFeatures = data.getCols();
+    
+    if (!data.hasLabels()) {
+        throw std::invalid_argument("Training data must have labels");
+    }
+    if (foldScale.getSize() > 0) {
+        partialFitFolded(data);
+        return;
+    }
+    if (!isTrained && partialFitRows == 0) {
+        weights = Vector(numFeatures, 0.0);
+        bias = 0.0;
+    } else if (weights.getSize() != numFeatures) {
+        throw std::invalid_argument("Number of features must match the model being updated");
+    }
+    if (numSamples == 0) {
+        return;
+    }
+    if (squaredGradients.getSize() != numFeatures) {
+        squaredGradients = Vector(numFeatures, 0.0);
+        biasSquaredGradient = 0.0;
+    }
+    
+    std::vector<int> order(numSamples);
+    for (int i = 0; i < numSamples; i++) {
+        order[i] = i;
+    }
+    DataView::shuffleIndices(order, shuffleSeed + static_cast<unsigned long>(partialFitCalls));
+    
+    int rows = (batchSize > 0) ? batchSize : ONLINE_BATCH_ROWS;
+    Vector dw(numFeatures, 0.0);
+    double loss = 0.0;
+    for (int begin = 0; begin < numSamples; begin += rows) {
+        int count = std::min(rows, numSamples - begin);
+        loss += adaptiveStep(data, order.data() + begin, count, dw) * count;
     }
     
+    partialFitCalls++;
+    partialFitRows += numSamples;
+    dataPasses = 1;
+    epochsRun = 1;
+    refreshActiveSet();
+    isTrained = true;
+    progress() << "Partial fit: " << numSamples << " rows (" << partialFitRows << " since last train), loss "
+              << std::fixed << std::setprecision(4) << (loss / numSamples) << std::endl;
+}
+
+void LogisticRegression::partialFit(const Matrix& X, const Vector& y) {
+    if (X.getRows() != y.getSize()) {
+        throw std::invalid_argument("Number of samples must match labels");
+    }
+    partialFit(DataView(X, y));
+}
+
+// Start AdaGrad afresh (new weights came from somewhere else)
+void LogisticRegression::resetOnlineState() {
+    squaredGradients = Vector();
+    biasSquaredGradient = 0.0;
+    partialFitRows = 0;
+    partialFitCalls = 0;
+    foldScale = Vector();
+    foldOffset = Vector();
+    scaledWeights = Vector();
+    scaledBias = 0.0;
+}
+
+// Scale the raw rows, run the ordinary update on the scaled-space
+// parameters, then fold the result again
+void LogisticRegression::partialFitFolded(const DataView& data) {
+    int numSamples = data.getRows();
+    int numFeatures = weights.getSize();
+    if (data.getCols() != numFeatures) {
+        throw std::invalid_argument("Number of features must match the model being updated");
+    }
+    
+    Matrix scaled(numSamples, numFeatures);
+    Vector labels = data.gatherLabels();
+    const double* s = foldScale.rawData();
+    const double* o = foldOffset.rawData();
+    Parallel::forRange(0, numSamples, Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            const double* x = data.row(i);
+            double* z = scaled.rowData(i);
+            for (int j = 0; j < numFeatures; j++) {
+                z[j] = x[j] * s[j] + o[j];
+            }
+        }
+    }, threadBudget);
+    
+    // Unfold: clear the scaler so the recursive call takes the plain path
+    Vector scale = std::move(foldScale);
+    Vector offset = std::move(foldOffset);
+    foldScale = Vector();
+    foldOffset = Vector();
+    weights = scaledWeights;
+    bias = scaledBias;
+    partialFit(DataView(scaled, labels));
+    
+    scaledWeights = weights;
+    scaledBias = bias;
+    for (int j = 0; j < numFeatures; j++) {
+        weights[j] = scaledWeights[j] * scale[j];
+        bias += scaledWeights[j] * offset[j];
+    }
+    foldScale = std::move(scale);
+    foldOffset = std::move(offset);
+    refreshActiveSet();
+}
+
+// Train from a background prefetch pipeline: while this thread computes the
+// update for one batch, the prefetcher reads and parses the following ones.
+// Every pass over the file plays the role of an epoch.
+void LogisticRegression::trainStream(BatchPrefetcher& batches) {
+    if (!batches.start()) {
+        throw std::runtime_error("Could not start batch prefetcher");
+    }
+    
+    int numFeatures = batches.getNumFeatures();
+    weights = Vector(numFeatures, 0.0);
+    bias = 0.0;
+    resetOnlineState();
+    
+    progress() << "\n========== STREAMING LOGISTIC REGRESSION ==========" << std::endl;
+    progress() << "Features: " << numFeatures << ", Batch size: " << batches.getBatchSize()
+              << ", Passes: " << batches.getNumPasses() << std::endl;
+    progress() << "Learning Rate: " << learningRate << std::endl;
+    progress() << "===================================================\n" << std::endl;
+    
+    DataBatch batch;
+    Vector dw(numFeatures, 0.0);  // Gradient scratch shared by every batch
+    int currentPass = 0;
+    dataPasses = 0;
+    epochsRun = 0;
+    double passLoss = 0.0;
+    long long passRows = 0;
+    
+    auto reportPass = [&]() {
+        if (passRows > 0) {
+            progress() << "Pass " << std::setw(4) << (currentPass + 1)
+                      << " - Loss: " << std::fixed << std::setprecision(4)
+                      << (passLoss / passRows) << std::endl;
+        }
+    };
+    
+    while (batches.next(batch)) {
+        if (batch.pass != currentPass) {
+            reportPass();
+            currentPass = batch.pass;
+            passLoss = 0.0;
+            passRows = 0;
+        }
+        
+        dataPasses = batch.pass + 1;
+        epochsRun = dataPasses;
+        int rows = batch.features.getRows();
+        double loss = gradientStep(DataView(batch.features, batch.labels), nullptr, rows,
+                                   getLearningRateAt(batch.pass), dw);
+        passLoss += loss * rows;
+        passRows += rows;
+    }
+    reportPass();
+    
+    refreshActiveSet();
+    isTrained = true;
+    progress() << "\nStreaming training completed!" << std::endl;
+    progress() << "===================================================\n" << std::endl;
+}
+
+// Make predictions
+Vector LogisticRegression::predict(const Matrix& X) {
+    return predict(DataView(X));
+}
+
+// Class predictions for the rows selected by a view
+Vector LogisticRegression::predict(const DataView& data) {
+    Vector predictions = predictProba(data);
+    for (int i = 0; i < predictions.getSize(); i++) {
+        predictions[i] = (predictions[i] >= 0.5) ? 1.0 : 0.0;  // Threshold at 0.5
+    }
+    return predictions;
+}
+
+// Class predictions for sparse rows
+Vector LogisticRegression::predict(const SparseMatrix& X) {
+    Vector predictions = predictProba(X);
+    for (int i = 0; i < predictions.getSize(); i++) {
+        predictions[i] = (predictions[i] >= 0.5) ? 1.0 : 0.0;  // Threshold at 0.5
+    }
     return predictions;
 }
 
 // Get probability predictions
 Vector LogisticRegression::predictProba(const Matrix& X) {
+    return predictProba(DataView(X));
+}
+
+// Probability predictions for the rows selected by a view
+Vector LogisticRegression::predictProba(const DataView& data) {
     if (!isTrained) {
         throw std::runtime_error("Model must be trained before prediction");
     }
     
-    int numSamples = X.getRows();
-    int numFeatures = X.getCols();
+    int numSamples = data.getRows();
+    int numFeatures = data.getCols();
+    
+    if (numFeatures != weights.getSize()) {
+        throw std::invalid_argument("Number of features must match trained model");
+    }
     
     Vector probabilities(numSamples);
+    if (usesActiveSet()) {
+        computeActiveProbabilities(data, probabilities.rawData());
+    } else {
+        computeProbabilities(data, probabilities.rawData());
+    }
+    return probabilities;
+}
+
+// Probability predictions for sparse rows
+Vector LogisticRegression::predictProba(const SparseMatrix& X) {
+    if (!isTrained) {
+        throw std::runtime_error("Model must be trained before prediction");
+    }
+    if (X.getCols() != weights.getSize()) {
+        throw std::invalid_argument("Number of features must match trained model");
+    }
     
-    for (int i = 0; i < numSamples; i++) {
-        double z = bias;
-        for (int j = 0; j < numFeatures; j++) {
-            z += weights[j] * X.getValue(i, j);
+    Vector probabilities(X.getRows());
+    const double* w = weights.rawData();
+    double* out = probabilities.rawData();
+    Parallel::forRange(0, X.getRows(), Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            out[i] = bias + X.dotRow(i, w);
+        }
+        VectorMath::sigmoid(out + begin, out + begin, static_cast<size_t>(end - begin));
+    }, threadBudget);
+    return probabilities;
+}
+
+// Rebuild the compact list of non-zero weights used for sparse scoring
+void LogisticRegression::refreshActiveSet() {
+    activeIndices.clear();
+    activeValues.clear();
+    for (int j = 0; j < weights.getSize(); j++) {
+        if (weights[j] != 0.0) {
+            activeIndices.push_back(j);
+            activeValues.push_back(weights[j]);
+        }
+    }
+}
+
+// Sparse scoring pays off once at most this fraction of weights is non-zero
+bool LogisticRegression::usesActiveSet() const {
+    return static_cast<double>(activeIndices.size()) <= ACTIVE_SET_MAX_DENSITY * weights.getSize();
+}
+
+// Same as computeProbabilities, but each score only reads the features
+// with non-zero weight: O(active features) per row instead of O(features)
+void LogisticRegression::computeActiveProbabilities(const DataView& data, double* out) const {
+    const int* index = activeIndices.data();
+    const double* value = activeValues.data();
+    int active = static_cast<int>(activeIndices.size());
+    double b = bias;
+    Parallel::forRange(0, data.getRows(), Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            const double* x = data.row(i);
+            double z = b;
+            for (int a = 0; a < active; a++) {
+                z += value[a] * x[index[a]];
+            }
+            out[i] = z;
+        }
+        VectorMath::sigmoid(out + begin, out + begin, static_cast<size_t>(end - begin));
+    }, threadBudget);
+}
+
+// Export the non-zero weights (e.g. of an L1-trained model)
+SparseWeights LogisticRegression::getSparseWeights() const {
+    if (!isTrained) {
+        throw std::runtime_error("Model must be trained before exporting weights");
+    }
+    SparseWeights exported;
+    exported.numFeatures = weights.getSize();
+    exported.indices = activeIndices;
+    exported.values = activeValues;
+    exported.bias = bias;
+    return exported;
+}
+
+// Load a model from its sparse form; it scores without further training
+void LogisticRegression::setSparseWeights(const SparseWeights& sparse) {
+    if (sparse.numFeatures < 0 || sparse.indices.size() != sparse.values.size()) {
+        throw std::invalid_argument("Sparse weights need one value per index");
+    }
+    weights = Vector(sparse.numFeatures, 0.0);
+    for (size_t a = 0; a < sparse.indices.size(); a++) {
+        int j = sparse.indices[a];
+        if (j < 0 || j >= sparse.numFeatures) {
+            throw std::out_of_range("Sparse weight index outside the feature range");
         }
-        probabilities[i] = sigmoid(z);
+        weights[j] = sparse.values[a];
+    }
+    bias = sparse.bias;
+    resetOnlineState();
+    refreshActiveSet();
+    isTrained = true;
+}
+
+// Fold a fitted affine scaler into the parameters: the returned model gives
+// the same scores on raw rows that this model gives on scaler-transformed rows
+LogisticRegression LogisticRegression::foldScaler(const AffineScaler& scaler) const {
+    if (!isTrained) {
+        throw std::runtime_error("Model must be trained before folding a scaler");
+    }
+    if (!scaler.getIsFitted()) {
+        throw std::runtime_error("Scaler must be fitted before folding");
     }
     
-    return probabilities;
+    Vector scale = scaler.getScale();
+    Vector offset = scaler.getOffset();
+    int numFeatures = weights.getSize();
+    if (scale.getSize() != numFeatures) {
+        throw std::invalid_argument("Number of features must match trained model");
+    }
+    
+    LogisticRegression folded(*this);
+    folded.validation = nullptr;  // Those rows are in the scaled space
+    if (foldScale.getSize() == 0) {
+        folded.foldScale = scale;
+        folded.foldOffset = offset;
+        folded.scaledWeights = weights;
+        folded.scaledBias = bias;
+    } else {
+        // Folded twice: the AdaGrad space is reached through both maps
+        for (int j = 0; j < numFeatures; j++) {
+            folded.foldOffset[j] = foldScale[j] * offset[j] + foldOffset[j];
+            folded.foldScale[j] = foldScale[j] * scale[j];
+        }
+    }
+    folded.weights = Vector(numFeatures);
+    folded.bias = bias;
+    for (int j = 0; j < numFeatures; j++) {
+        folded.weights[j] = weights[j] * scale[j];
+        folded.bias += weights[j] * offset[j];
+    }
+    folded.refreshActiveSet();
+    return folded;
 }
 
 // Display model information
@@ -156,9 +1165,18 @@ void LogisticRegression::displayInfo() const {
     std::cout << "Logistic Regression Model" << std::endl;
     std::cout << "Learning Rate: " << learningRate << std::endl;
     std::cout << "Epochs: " << epochs << std::endl;
+    if (optimizer != nullptr) {
+        std::cout << "Optimizer: " << optimizer->getName() << std::endl;
+    }
+    std::cout << "Batch size: " << (batchSize > 0 ? std::to_string(batchSize) : "full") << std::endl;
     std::cout << "Trained: " << (isTrained ? "Yes" : "No") << std::endl;
+    if (regularizer.isActive()) {
+        std::cout << "Regularization: " << regularizer.getName() << " (lambda " << regularizer.getStrength()
+                  << ", L1 ratio " << regularizer.getL1Ratio() << ")" << std::endl;
+    }
     if (isTrained) {
         std::cout << "Number of features: " << weights.getSize() << std::endl;
+        std::cout << "Non-zero weights: " << activeIndices.size() << std::endl;
         std::cout << "Bias: " << bias << std::endl;
     }
 }
@@ -176,14 +1194,70 @@ double LogisticRegression::getLearningRate() const {
     return learningRate;
 }
 
+// Scheduled rate for a given epoch (streamed training: pass)
+double LogisticRegression::getLearningRateAt(int epoch) const {
+    switch (schedule) {
+        case INVERSE_TIME:
+            return learningRate / (1.0 + decay * epoch);
+        case EXPONENTIAL:
+            return learningRate * std::pow(decay, epoch);
+        default:
+            return learningRate;
+    }
+}
+
 int LogisticRegression::getEpochs() const {
     return epochs;
 }
 
+int LogisticRegression::getBatchSize() const {
+    return batchSize;
+}
+
+bool LogisticRegression::getDeterministicReduction() const {
+    return deterministicReduction;
+}
+
+bool LogisticRegression::getAsynchronous() const {
+    return asynchronous;
+}
+
+int LogisticRegression::getEpochsRun() const {
+    return epochsRun;
+}
+
+int LogisticRegression::getDataPasses() const {
+    return dataPasses;
+}
+
+Regularizer LogisticRegression::getRegularizer() const {
+    return regularizer;
+}
+
+int LogisticRegression::getActiveFeatureCount() const {
+    return static_cast<int>(activeIndices.size());
+}
+
 bool LogisticRegression::getIsTrained() const {
     return isTrained;
 }
 
+long long LogisticRegression::getPartialFitRows() const {
+    return partialFitRows;
+}
+
+bool LogisticRegression::getVerbose() const {
+    return verbose;
+}
+
+int LogisticRegression::getThreadBudget() const {
+    return threadBudget;
+}
+
+const DataView* LogisticRegression::getValidationData() const {
+    return validation;
+}
+
 // Setters
 void LogisticRegression::setLearningRate(double lr) {
     learningRate = lr;
@@ -192,3 +1266,66 @@ void LogisticRegression::setLearningRate(double lr) {
 void LogisticRegression::setEpochs(int numEpochs) {
     epochs = numEpochs;
 }
+
+void LogisticRegression::setBatchSize(int rows) {
+    if (rows < 0) {
+        throw std::invalid_argument("Batch size must be non-negative");
+    }
+    batchSize = rows;
+}
+
+void LogisticRegression::setDeterministicReduction(bool enabled) {
+    deterministicReduction = enabled;
+}
+
+void LogisticRegression::setStoppingCriteria(const StoppingCriteria& criteria) {
+    if (criteria.lossTolerance < 0 || criteria.gradientTolerance < 0 || criteria.patience < 0) {
+        throw std::invalid_argument("Stopping criteria must be non-negative");
+    }
+    stopping = criteria;
+}
+
+void LogisticRegression::setValidationData(const DataView* view) {
+    if (view != nullptr && !view->hasLabels()) {
+        throw std::invalid_argument("Validation data must have labels");
+    }
+    validation = view;
+}
+
+void LogisticRegression::setOptimizer(std::shared_ptr<const Optimizer> solver) {
+    optimizer = std::move(solver);
+}
+
+void LogisticRegression::setRegularizer(const Regularizer& penalty) {
+    regularizer = penalty;
+}
+
+void LogisticRegression::setAsynchronous(bool enabled) {
+    asynchronous = enabled;
+}
+
+void LogisticRegression::setVerbose(bool enabled) {
+    verbose = enabled;
+}
+
+void LogisticRegression::setThreadBudget(int threads) {
+    if (threads < 0) {
+        throw std::invalid_argument("Thread budget must be non-negative");
+    }
+    threadBudget = threads;
+}
+
+void LogisticRegression::setShuffleSeed(unsigned long seed) {
+    shuffleSeed = seed;
+}
+
+void LogisticRegression::setSchedule(LearningRateSchedule type, double decayRate) {
+    if (type == EXPONENTIAL && (decayRate <= 0.0 || decayRate > 1.0)) {
+        throw std::invalid_argument("Exponential decay factor must be in (0, 1]");
+    }
+    if (type == INVERSE_TIME && decayRate < 0.0) {
+        throw std::invalid_argument("Inverse-time decay must be non-negative");
+    }
+    schedule = type;
+    decay = decayRate;
+}
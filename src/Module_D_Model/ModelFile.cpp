@@ -0,0 +1,378 @@
+#include "ModelFile.h"
+#include "Parallel.h"
+#include "VectorMath.h"
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#define TITAN_HAVE_FSYNC 1
+#endif
+
+namespace {
+
+const char MODEL_MAGIC[8] = {'T', 'L', 'M', 'O', 'D', 'E', 'L', '\0'};
+const uint32_t MODEL_VERSION = 2;  // 2: folded files also store the scaled-space parameters
+const uint64_t MODEL_ALIGNMENT = 64;
+const uint32_t FOLDED_SCALER = 1;  // Flag: fold sections present, weights are folded
+
+// Fixed-size file header, exactly one alignment unit long
+struct ModelHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t flags;
+    uint64_t numFeatures;
+    uint64_t checksum;       // Checksum of every section after the header
+    uint64_t reserved[4];
+};
+static_assert(sizeof(ModelHeader) == MODEL_ALIGNMENT, "Model header must fill one alignment unit");
+
+// Training hyperparameters, one alignment unit
+struct ModelParameters {
+    double learningRate;
+    double decay;
+    double regularizationStrength;
+    double l1Ratio;
+    uint64_t shuffleSeed;
+    int32_t epochs;
+    int32_t batchSize;
+    int32_t schedule;
+    int32_t regularizerType;
+    uint64_t reserved;
+};
+static_assert(sizeof(ModelParameters) == MODEL_ALIGNMENT, "Model parameters must fill one alignment unit");
+
+uint64_t alignUp(uint64_t value) {
+    return (value + MODEL_ALIGNMENT - 1) / MODEL_ALIGNMENT * MODEL_ALIGNMENT;
+}
+
+// Bytes of one padded section holding count doubles
+uint64_t sectionBytes(uint64_t count) {
+    return alignUp(count * sizeof(double));
+}
+
+// Append count doubles to a section buffer, zero padded to alignment
+void appendSection(std::vector<unsigned char>& payload, const double* values, uint64_t count) {
+    size_t start = payload.size();
+    payload.resize(start + sectionBytes(count), 0);
+    if (count > 0) {
+        std::memcpy(payload.data() + start, values, count * sizeof(double));
+    }
+}
+
+// Every field toModel() turns into a setting is in its valid range, so a
+// file that passes the checksum can never make toModel() throw
+bool validParameters(const ModelParameters& parameters) {
+    if (!std::isfinite(parameters.learningRate) || !std::isfinite(parameters.decay) ||
+        parameters.epochs < 0 || parameters.batchSize < 0) {
+        return false;
+    }
+    switch (parameters.schedule) {
+        case LogisticRegression::CONSTANT:
+            break;
+        case LogisticRegression::INVERSE_TIME:
+            if (parameters.decay < 0.0) {
+                return false;
+            }
+            break;
+        case LogisticRegression::EXPONENTIAL:
+            if (parameters.decay <= 0.0 || parameters.decay > 1.0) {
+                return false;
+            }
+            break;
+        default:
+            return false;
+    }
+    if (parameters.regularizerType < Regularizer::NONE || parameters.regularizerType > Regularizer::ELASTIC_NET) {
+        return false;
+    }
+    return std::isfinite(parameters.regularizationStrength) && parameters.regularizationStrength >= 0.0 &&
+           parameters.l1Ratio >= 0.0 && parameters.l1Ratio <= 1.0;
+}
+
+// Flush a file or directory to stable storage; true where that is not
+// supported
+bool syncToDisk(const std::string& path) {
+#ifdef TITAN_HAVE_FSYNC
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    bool synced = ::fsync(fd) == 0;
+    ::close(fd);
+    return synced;
+#else
+    (void)path;
+    return true;
+#endif
+}
+
+} // namespace
+
+// Constructor
+ModelFile::ModelFile()
+    : weights(nullptr), scale(nullptr), offset(nullptr), scaledParameters(nullptr), numFeatures(0) {}
+
+// Serialize parameters and weights, then write to a temporary file, flush it
+// to disk and rename it into place
+bool ModelFile::save(const std::string& filepath, const LogisticRegression& model,
+                     const AffineScaler* scaler) {
+    if (!model.isTrained) {
+        return false;
+    }
+
+    const LogisticRegression* stored = &model;
+    LogisticRegression folded;
+    if (scaler != nullptr) {
+        folded = model.foldScaler(*scaler);
+        stored = &folded;
+    }
+    uint64_t d = static_cast<uint64_t>(stored->weights.getSize());
+    // A model folded earlier keeps its fold even when saved without a scaler
+    bool withFold = stored->foldScale.getSize() > 0;
+
+    ModelHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, MODEL_MAGIC, sizeof(MODEL_MAGIC));
+    header.version = MODEL_VERSION;
+    header.flags = withFold ? FOLDED_SCALER : 0;
+    header.numFeatures = d;
+
+    ModelParameters parameters;
+    std::memset(&parameters, 0, sizeof(parameters));
+    parameters.learningRate = model.learningRate;
+    parameters.decay = model.decay;
+    parameters.regularizationStrength = model.regularizer.getStrength();
+    parameters.l1Ratio = model.regularizer.getL1Ratio();
+    parameters.shuffleSeed = static_cast<uint64_t>(model.shuffleSeed);
+    parameters.epochs = model.epochs;
+    parameters.batchSize = model.batchSize;
+    parameters.schedule = static_cast<int32_t>(model.schedule);
+    parameters.regularizerType = static_cast<int32_t>(model.regularizer.getType());
+
+    // Payload: parameters, [w, b], then the optional fold sections
+    std::vector<unsigned char> payload(sizeof(parameters));
+    std::memcpy(payload.data(), &parameters, sizeof(parameters));
+    std::vector<double> parameterVector(stored->weights.rawData(), stored->weights.rawData() + d);
+    parameterVector.push_back(stored->bias);
+    appendSection(payload, parameterVector.data(), d + 1);
+    if (withFold) {
+        // The combined transform and the scaled-space [w, b]: those cannot be
+        // recovered as w' / s (a constant MinMax column has s = 0)
+        appendSection(payload, stored->foldScale.rawData(), d);
+        appendSection(payload, stored->foldOffset.rawData(), d);
+        std::vector<double> scaledVector(stored->scaledWeights.rawData(), stored->scaledWeights.rawData() + d);
+        scaledVector.push_back(stored->scaledBias);
+        appendSection(payload, scaledVector.data(), d + 1);
+    }
+    header.checksum = MappedFile::checksum(payload.data(), payload.size());
+
+    std::string tempPath = filepath + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) {
+            return false;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        if (!out) {
+            out.close();
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    // Without the flush a crash after the rename can leave a renamed but
+    // empty file in place of the old model
+    if (!syncToDisk(tempPath)) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, filepath, ec);
+    if (ec) {
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    std::filesystem::path directory = std::filesystem::path(filepath).parent_path();
+    syncToDisk(directory.empty() ? "." : directory.string());  // Persist the rename itself
+    return true;
+}
+
+// Copying load built on the zero-copy one
+bool ModelFile::load(const std::string& filepath, LogisticRegression& model) {
+    ModelFile mapped;
+    if (!mapped.open(filepath)) {
+        return false;
+    }
+    model = mapped.toModel();
+    return true;
+}
+
+// Map the file, validate header, sizes, checksum and parameters, and point
+// into it
+bool ModelFile::open(const std::string& filepath) {
+    close();
+    if (!file.open(filepath) || file.getSize() < sizeof(ModelHeader) + sizeof(ModelParameters)) {
+        file.close();
+        return false;
+    }
+
+    ModelHeader header;
+    std::memcpy(&header, file.getData(), sizeof(header));
+    if (std::memcmp(header.magic, MODEL_MAGIC, sizeof(MODEL_MAGIC)) != 0 ||
+        header.version != MODEL_VERSION || (header.flags & ~FOLDED_SCALER) != 0 ||
+        header.numFeatures > static_cast<uint64_t>(INT32_MAX - 1)) {
+        file.close();
+        return false;  // Foreign or outdated file
+    }
+
+    bool withScaler = (header.flags & FOLDED_SCALER) != 0;
+    uint64_t d = header.numFeatures;
+    uint64_t expected = sizeof(ModelHeader) + sizeof(ModelParameters) + sectionBytes(d + 1) +
+                        (withScaler ? 2 * sectionBytes(d) + sectionBytes(d + 1) : 0);
+    const unsigned char* base = file.getData();
+    if (file.getSize() != expected ||
+        MappedFile::checksum(base + sizeof(ModelHeader), file.getSize() - sizeof(ModelHeader)) != header.checksum) {
+        file.close();
+        return false;  // Truncated or corrupt
+    }
+    ModelParameters parameters;
+    std::memcpy(&parameters, base + sizeof(ModelHeader), sizeof(parameters));
+    if (!validParameters(parameters)) {
+        file.close();
+        return false;  // Written by something other than save()
+    }
+
+    // Every section starts on a 64-byte boundary of a page-aligned mapping,
+    // so the doubles can be read in place
+    uint64_t position = sizeof(ModelHeader) + sizeof(ModelParameters);
+    weights = reinterpret_cast<const double*>(base + position);
+    position += sectionBytes(d + 1);
+    if (withScaler) {
+        scale = reinterpret_cast<const double*>(base + position);
+        offset = reinterpret_cast<const double*>(base + position + sectionBytes(d));
+        scaledParameters = reinterpret_cast<const double*>(base + position + 2 * sectionBytes(d));
+    }
+    numFeatures = static_cast<int>(d);
+    return true;
+}
+
+// Release the mapping
+void ModelFile::close() {
+    file.close();
+    weights = nullptr;
+    scale = nullptr;
+    offset = nullptr;
+    scaledParameters = nullptr;
+    numFeatures = 0;
+}
+
+bool ModelFile::isOpen() const {
+    return weights != nullptr;
+}
+
+// Linear scores from the mapped weights per block, then one vectorized sigmoid
+Vector ModelFile::predictProba(const DataView& data) const {
+    if (!isOpen()) {
+        throw std::runtime_error("Model file must be open before prediction");
+    }
+    if (data.getCols() != numFeatures) {
+        throw std::invalid_argument("Number of features must match saved model");
+    }
+
+    Vector probabilities(data.getRows());
+    double* out = probabilities.rawData();
+    const double* w = weights;
+    double b = weights[numFeatures];
+    int d = numFeatures;
+    Parallel::forRange(0, data.getRows(), Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            const double* x = data.row(i);
+            double z = b;
+            for (int j = 0; j < d; j++) {
+                z += w[j] * x[j];
+            }
+            out[i] = z;
+        }
+        VectorMath::sigmoid(out + begin, out + begin, static_cast<size_t>(end - begin));
+    });
+    return probabilities;
+}
+
+// Class predictions
+Vector ModelFile::predict(const DataView& data) const {
+    Vector predictions = predictProba(data);
+    for (int i = 0; i < predictions.getSize(); i++) {
+        predictions[i] = (predictions[i] >= 0.5) ? 1.0 : 0.0;  // Threshold at 0.5
+    }
+    return predictions;
+}
+
+// Rebuild a LogisticRegression with the saved parameters and hyperparameters
+LogisticRegression ModelFile::toModel() const {
+    if (!isOpen()) {
+        throw std::runtime_error("Model file must be open before conversion");
+    }
+
+    ModelParameters parameters;
+    std::memcpy(&parameters, file.getData() + sizeof(ModelHeader), sizeof(parameters));
+
+    LogisticRegression model(parameters.learningRate, parameters.epochs);
+    model.batchSize = parameters.batchSize;
+    model.shuffleSeed = static_cast<unsigned long>(parameters.shuffleSeed);
+    model.schedule = static_cast<LogisticRegression::LearningRateSchedule>(parameters.schedule);
+    model.decay = parameters.decay;
+    model.regularizer = Regularizer(static_cast<Regularizer::Type>(parameters.regularizerType),
+                                    parameters.regularizationStrength, parameters.l1Ratio);
+    model.weights = Vector(numFeatures);
+    std::memcpy(model.weights.rawData(), weights, static_cast<size_t>(numFeatures) * sizeof(double));
+    model.bias = weights[numFeatures];
+    if (scale != nullptr) {
+        // Restore the fold, so partialFit keeps stepping in the scaled space
+        size_t bytes = static_cast<size_t>(numFeatures) * sizeof(double);
+        model.foldScale = Vector(numFeatures);
+        model.foldOffset = Vector(numFeatures);
+        model.scaledWeights = Vector(numFeatures);
+        std::memcpy(model.foldScale.rawData(), scale, bytes);
+        std::memcpy(model.foldOffset.rawData(), offset, bytes);
+        std::memcpy(model.scaledWeights.rawData(), scaledParameters, bytes);
+        model.scaledBias = scaledParameters[numFeatures];
+    }
+    model.refreshActiveSet();
+    model.isTrained = true;
+    return model;
+}
+
+// Getters
+int ModelFile::getNumFeatures() const {
+    return numFeatures;
+}
+
+const double* ModelFile::getWeights() const {
+    return weights;
+}
+
+double ModelFile::getBias() const {
+    return isOpen() ? weights[numFeatures] : 0.0;
+}
+
+bool ModelFile::hasScaler() const {
+    return scale != nullptr;
+}
+
+const double* ModelFile::getScale() const {
+    return scale;
+}
+
+const double* ModelFile::getOffset() const {
+    return offset;
+}
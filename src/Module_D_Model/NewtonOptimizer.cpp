@@ -0,0 +1,97 @@
+#include "NewtonOptimizer.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+
+namespace {
+const double ARMIJO = 1e-4;         // Sufficient-decrease constant
+const int MAX_BACKTRACKS = 30;
+}
+
+// Constructor
+NewtonOptimizer::NewtonOptimizer(int maxIter, double tol, int parameterLimit)
+    : Optimizer(maxIter, tol), maxParameters(parameterLimit) {}
+
+// Destructor
+NewtonOptimizer::~NewtonOptimizer() {}
+
+// Newton / IRLS iterations with a damped (backtracking) step
+int NewtonOptimizer::minimize(LogisticObjective& objective, Vector& theta, std::ostream& log) const {
+    int n = objective.getNumParameters();
+    if (n > maxParameters) {
+        throw std::invalid_argument("Too many features for Newton's method; use L-BFGS");
+    }
+
+    Vector gradient;
+    Matrix hessian;
+    double loss = objective.evaluate(theta, gradient, hessian);
+    int iterations = 0;
+
+    while (iterations < maxIterations) {
+        double largest = 0.0;
+        for (int i = 0; i < n; i++) {
+            largest = std::max(largest, std::fabs(gradient[i]));
+        }
+        if (largest <= tolerance) {
+            break;
+        }
+
+        // Solve H d = g; add a growing ridge if H is (numerically) singular,
+        // e.g. for constant columns or separable data
+        Vector direction;
+        double ridge = 0.0;
+        while (!hessian.solveCholesky(gradient, direction)) {
+            double previous = ridge;
+            ridge = (ridge == 0.0) ? 1e-10 : ridge * 10.0;
+            for (int i = 0; i < n; i++) {
+                hessian.rowData(i)[i] += ridge - previous;
+            }
+            if (ridge > 1e6) {
+                throw std::runtime_error("Hessian is not positive definite");
+            }
+        }
+
+        double slope = 0.0;
+        for (int i = 0; i < n; i++) {
+            slope -= gradient[i] * direction[i];
+        }
+
+        // Full Newton step first; halve until the loss decreases enough.
+        // Candidates cost loss and gradient only (O(n d)); the O(n d^2)
+        // Hessian is built once, at the accepted point
+        double step = 1.0;
+        Vector candidate(n);
+        Vector candidateGradient;
+        bool accepted = false;
+        double candidateLoss = loss;
+        for (int attempt = 0; attempt < MAX_BACKTRACKS; attempt++) {
+            for (int i = 0; i < n; i++) {
+                candidate[i] = theta[i] - step * direction[i];
+            }
+            candidateLoss = objective.evaluate(candidate, candidateGradient);
+            if (candidateLoss <= loss + ARMIJO * step * slope) {
+                accepted = true;
+                break;
+            }
+            step *= 0.5;
+        }
+        if (!accepted) {
+            break;  // No further decrease possible at this precision
+        }
+
+        theta = candidate;
+        loss = objective.evaluate(theta, gradient, hessian);
+        iterations++;
+
+        log << "Iteration " << std::setw(3) << iterations
+                  << " - Loss: " << std::fixed << std::setprecision(6) << loss
+                  << " (passes: " << objective.getDataPasses() << ")" << std::endl;
+    }
+    return iterations;
+}
+
+const char* NewtonOptimizer::getName() const {
+    return "Newton/IRLS";
+}
@@ -0,0 +1,206 @@
+#include "Pipeline.h"
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+// Target working set per block: small enough to stay in L2 across all stages
+const int BLOCK_BYTES = 64 * 1024;
+}
+
+// Constructor
+Pipeline::Pipeline() : model(nullptr), validation(nullptr), isFitted(false) {}
+
+// Destructor - stages belong to the caller
+Pipeline::~Pipeline() {}
+
+// Append a scaler stage
+Pipeline& Pipeline::addScaler(Scaler& scaler) {
+    scalers.push_back(&scaler);
+    isFitted = false;
+    return *this;
+}
+
+// Set the final estimator
+Pipeline& Pipeline::setModel(Model& finalModel) {
+    model = &finalModel;
+    isFitted = false;
+    return *this;
+}
+
+// Held-out rows for the model, in the unscaled feature space
+void Pipeline::setValidationData(const DataView* view) {
+    if (view != nullptr && !view->hasLabels()) {
+        throw std::invalid_argument("Validation data must have labels");
+    }
+    validation = view;
+}
+
+// Rows per block so that one block of doubles fits the working-set target
+int Pipeline::rowsPerBlock(int cols) const {
+    int bytesPerRow = std::max(1, cols) * static_cast<int>(sizeof(double));
+    return std::max(16, BLOCK_BYTES / bytesPerRow);
+}
+
+// Copy rows [begin, end) of the view into block and run the first numStages
+// scalers over it in place; block is reused when its shape already fits
+void Pipeline::scaleBlock(const DataView& data, int begin, int end,
+                          int numStages, Matrix& block) const {
+    int rows = end - begin;
+    int cols = data.getCols();
+    if (block.getRows() != rows || block.getCols() != cols) {
+        block = Matrix(rows, cols);
+    }
+    for (int i = 0; i < rows; i++) {
+        const double* src = data.row(begin + i);
+        std::copy(src, src + cols, block.rowData(i));
+    }
+    for (int s = 0; s < numStages; s++) {
+        scalers[s]->transformInPlace(block);
+    }
+}
+
+// Fit every stage: each scaler sees the rows as transformed by the ones before it
+void Pipeline::fit(const DataView& data) {
+    if (data.getRows() == 0) {
+        throw std::invalid_argument("Cannot fit pipeline on empty data");
+    }
+
+    int blockRows = rowsPerBlock(data.getCols());
+    Matrix block;
+
+    // One streamed pass per scaler; fit() on the first block resets it
+    for (int s = 0; s < static_cast<int>(scalers.size()); s++) {
+        for (int begin = 0; begin < data.getRows(); begin += blockRows) {
+            int end = std::min(data.getRows(), begin + blockRows);
+            scaleBlock(data, begin, end, s, block);
+            if (begin == 0) {
+                scalers[s]->fit(block);
+            } else {
+                scalers[s]->partialFit(block);
+            }
+        }
+    }
+
+    if (model != nullptr) {
+        if (!data.hasLabels()) {
+            throw std::invalid_argument("Training data must have labels");
+        }
+        if (!scalers.empty() && model->getValidationData() != nullptr) {
+            throw std::invalid_argument("Validation rows set on the model would skip the scalers; "
+                                        "use Pipeline::setValidationData");
+        }
+        Matrix modelInput = transform(data);
+        Vector labels = data.gatherLabels();
+
+        // The validation rows get the same scaling; the scaled copy only
+        // lives for this training run
+        Matrix validationInput;
+        Vector validationLabels;
+        DataView validationView;
+        if (validation != nullptr) {
+            validationInput = transform(*validation);
+            validationLabels = validation->gatherLabels();
+            validationView = DataView(validationInput, validationLabels);
+            model->setValidationData(&validationView);
+        }
+        try {
+            model->train(DataView(modelInput, labels));
+        } catch (...) {
+            if (validation != nullptr) {
+                model->setValidationData(nullptr);
+            }
+            throw;
+        }
+        if (validation != nullptr) {
+            model->setValidationData(nullptr);
+        }
+    }
+
+    isFitted = true;
+}
+
+void Pipeline::fit(const Matrix& X, const Vector& y) {
+    if (X.getRows() != y.getSize()) {
+        throw std::invalid_argument("Number of samples must match labels");
+    }
+    fit(DataView(X, y));
+}
+
+// Run the scaler stages block by block, writing each finished block once
+Matrix Pipeline::transform(const DataView& data) const {
+    int rows = data.getRows();
+    int cols = data.getCols();
+    int blockRows = rowsPerBlock(cols);
+    int numStages = static_cast<int>(scalers.size());
+    Matrix result(rows, cols);
+    Matrix block;
+
+    for (int begin = 0; begin < rows; begin += blockRows) {
+        int end = std::min(rows, begin + blockRows);
+        scaleBlock(data, begin, end, numStages, block);
+        for (int i = begin; i < end; i++) {
+            const double* src = block.rowData(i - begin);
+            std::copy(src, src + cols, result.rowData(i));
+        }
+    }
+    return result;
+}
+
+// Model interface: training is fitting the whole chain
+void Pipeline::train(const Matrix& X, const Vector& y) {
+    fit(X, y);
+}
+
+void Pipeline::train(const DataView& data) {
+    fit(data);
+}
+
+// Make predictions
+Vector Pipeline::predict(const Matrix& X) {
+    return predict(DataView(X));
+}
+
+// Scale and score one cache-sized block at a time
+Vector Pipeline::predict(const DataView& data) {
+    if (model == nullptr) {
+        throw std::runtime_error("Pipeline has no model stage");
+    }
+    if (!isFitted) {
+        throw std::runtime_error("Pipeline must be fitted before prediction");
+    }
+
+    int rows = data.getRows();
+    int blockRows = rowsPerBlock(data.getCols());
+    int numStages = static_cast<int>(scalers.size());
+    Vector predictions(rows);
+    Matrix block;
+
+    for (int begin = 0; begin < rows; begin += blockRows) {
+        int end = std::min(rows, begin + blockRows);
+        scaleBlock(data, begin, end, numStages, block);
+        Vector blockPredictions = model->predict(block);
+        std::copy(blockPredictions.rawData(), blockPredictions.rawData() + (end - begin),
+                  predictions.rawData() + begin);
+    }
+    return predictions;
+}
+
+// Display pipeline information
+void Pipeline::displayInfo() const {
+    std::cout << "Pipeline: " << scalers.size() << " scaler stage(s) + "
+              << (model != nullptr ? "model" : "no model") << std::endl;
+    std::cout << "Fitted: " << (isFitted ? "Yes" : "No") << std::endl;
+    if (model != nullptr) {
+        model->displayInfo();
+    }
+}
+
+// Getters
+int Pipeline::getNumScalers() const {
+    return static_cast<int>(scalers.size());
+}
+
+bool Pipeline::getIsFitted() const {
+    return isFitted;
+}
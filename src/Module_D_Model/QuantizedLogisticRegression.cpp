@@ -0,0 +1,239 @@
+#include "QuantizedLogisticRegression.h"
+#include "Parallel.h"
+#include "VectorMath.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+
+namespace {
+
+const int CODE_LIMIT = 127;  // Symmetric code range; -128 is never produced
+
+// Products of two codes are at most 127^2, so an int32 partial sum is safe
+// for this many of them
+const int DOT_CHUNK = 65536;
+
+// Clip to the code range and round to the nearest code (halves up). Shifting
+// by CODE_LIMIT + 0.5 makes the value positive, so truncation is rounding and
+// the loop vectorizes to max / min / convert instructions
+int8_t toCode(double value) {
+    double shifted = value + (CODE_LIMIT + 0.5);
+    shifted = std::min(2.0 * CODE_LIMIT + 0.5, std::max(0.5, shifted));  // NaN -> lowest code
+    return static_cast<int8_t>(static_cast<int>(shifted) - CODE_LIMIT);
+}
+
+int paddedStride(int cols) {
+    int a = QuantizedRows::ROW_ALIGNMENT;
+    return (cols + a - 1) / a * a;
+}
+
+} // namespace
+
+// Default constructor: an empty model that cannot score
+QuantizedLogisticRegression::QuantizedLogisticRegression()
+    : numFeatures(0), stride(0), weightStep(1.0), bias(0.0) {}
+
+// Calibrate feature ranges on the sample, then fold the steps into the weights
+QuantizedLogisticRegression::QuantizedLogisticRegression(const LogisticRegression& model,
+                                                         const DataView& calibration) {
+    Vector w = model.getWeights();
+    numFeatures = w.getSize();
+    if (numFeatures == 0) {
+        throw std::runtime_error("Model must be trained before quantization");
+    }
+    if (calibration.getRows() == 0 || calibration.getCols() != numFeatures) {
+        throw std::invalid_argument("Calibration sample must be non-empty and match the model's features");
+    }
+    stride = paddedStride(numFeatures);
+
+    // Per-feature range of the sample
+    std::vector<double> lo(calibration.row(0), calibration.row(0) + numFeatures);
+    std::vector<double> hi(lo);
+    for (int i = 1; i < calibration.getRows(); i++) {
+        const double* x = calibration.row(i);
+        for (int j = 0; j < numFeatures; j++) {
+            lo[j] = std::min(lo[j], x[j]);
+            hi[j] = std::max(hi[j], x[j]);
+        }
+    }
+
+    center.assign(numFeatures, 0.0);
+    inverseStep.assign(numFeatures, 0.0);
+    std::vector<double> folded(numFeatures);
+    bias = model.getBias();
+    double largest = 0.0;
+    for (int j = 0; j < numFeatures; j++) {
+        double step = (hi[j] - lo[j]) / (2.0 * CODE_LIMIT);
+        center[j] = 0.5 * (lo[j] + hi[j]);
+        inverseStep[j] = (step > 0.0) ? 1.0 / step : 0.0;  // Constant features always code 0
+        bias += w[j] * center[j];
+        folded[j] = w[j] * step;
+        largest = std::max(largest, std::fabs(folded[j]));
+    }
+
+    weightStep = (largest > 0.0) ? largest / CODE_LIMIT : 1.0;
+    weightCodes.assign(stride, 0);
+    for (int j = 0; j < numFeatures; j++) {
+        weightCodes[j] = toCode(folded[j] / weightStep);
+    }
+}
+
+// Quantize every row of the view
+QuantizedRows QuantizedLogisticRegression::quantize(const DataView& data) const {
+    if (data.getCols() != numFeatures) {
+        throw std::invalid_argument("Number of features must match quantized model");
+    }
+    QuantizedRows rows;
+    rows.rows = data.getRows();
+    rows.cols = numFeatures;
+    rows.stride = stride;
+    rows.codes.assign(static_cast<size_t>(rows.rows) * stride, 0);
+    Parallel::forRange(0, rows.rows, Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        for (int i = begin; i < end; i++) {
+            quantizeRow(data.row(i), rows.row(i));
+        }
+    });
+    return rows;
+}
+
+// Codes for one row; the padding bytes are left untouched (zero)
+void QuantizedLogisticRegression::quantizeRow(const double* x, int8_t* codes) const {
+    for (int j = 0; j < numFeatures; j++) {
+        codes[j] = toCode((x[j] - center[j]) * inverseStep[j]);
+    }
+}
+
+// Widening int8 multiply-add, written as a plain loop so the compiler
+// vectorizes it with integer multiply-adds (pmaddwd on x86)
+int64_t QuantizedLogisticRegression::dot(const int8_t* a, const int8_t* b, int n) {
+    int64_t total = 0;
+    for (int start = 0; start < n; start += DOT_CHUNK) {
+        int end = std::min(n, start + DOT_CHUNK);
+        int32_t partial = 0;
+        for (int j = start; j < end; j++) {
+            partial += static_cast<int32_t>(a[j]) * static_cast<int32_t>(b[j]);
+        }
+        total += partial;
+    }
+    return total;
+}
+
+// z = bias + weightStep * <codes, weight codes>. Four rows share each load
+// of the weight codes, and their sums vectorize side by side
+void QuantizedLogisticRegression::scoreRows(const QuantizedRows& rows, int first, int count, double* z) const {
+    const int8_t* r = weightCodes.data();
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const int8_t* a0 = rows.row(first + i);
+        const int8_t* a1 = rows.row(first + i + 1);
+        const int8_t* a2 = rows.row(first + i + 2);
+        const int8_t* a3 = rows.row(first + i + 3);
+        int64_t totals[4] = {0, 0, 0, 0};
+        for (int start = 0; start < stride; start += DOT_CHUNK) {
+            int end = std::min(stride, start + DOT_CHUNK);
+            int32_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+            for (int j = start; j < end; j++) {
+                int32_t w = r[j];
+                s0 += static_cast<int32_t>(a0[j]) * w;
+                s1 += static_cast<int32_t>(a1[j]) * w;
+                s2 += static_cast<int32_t>(a2[j]) * w;
+                s3 += static_cast<int32_t>(a3[j]) * w;
+            }
+            totals[0] += s0;
+            totals[1] += s1;
+            totals[2] += s2;
+            totals[3] += s3;
+        }
+        for (int k = 0; k < 4; k++) {
+            z[i + k] = bias + weightStep * static_cast<double>(totals[k]);
+        }
+    }
+    for (; i < count; i++) {
+        z[i] = bias + weightStep * static_cast<double>(dot(rows.row(first + i), r, stride));
+    }
+}
+
+// Scores per block from the int8 codes, then one vectorized sigmoid
+Vector QuantizedLogisticRegression::predictProba(const QuantizedRows& rows) const {
+    if (numFeatures == 0) {
+        throw std::runtime_error("Quantized model is empty");
+    }
+    if (rows.cols != numFeatures || rows.stride != stride) {
+        throw std::invalid_argument("Quantized rows were not produced for this model");
+    }
+
+    Vector probabilities(rows.rows);
+    double* out = probabilities.rawData();
+    Parallel::forRange(0, rows.rows, Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        scoreRows(rows, begin, end - begin, out + begin);
+        VectorMath::sigmoid(out + begin, out + begin, static_cast<size_t>(end - begin));
+    });
+    return probabilities;
+}
+
+// Quantize each row into a per-block buffer as it is scored
+Vector QuantizedLogisticRegression::predictProba(const DataView& data) const {
+    if (numFeatures == 0) {
+        throw std::runtime_error("Quantized model is empty");
+    }
+    if (data.getCols() != numFeatures) {
+        throw std::invalid_argument("Number of features must match quantized model");
+    }
+
+    Vector probabilities(data.getRows());
+    double* out = probabilities.rawData();
+    const int8_t* r = weightCodes.data();
+    Parallel::forRange(0, data.getRows(), Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        std::vector<int8_t> codes(stride, 0);
+        for (int i = begin; i < end; i++) {
+            quantizeRow(data.row(i), codes.data());
+            out[i] = bias + weightStep * static_cast<double>(dot(codes.data(), r, stride));
+        }
+        VectorMath::sigmoid(out + begin, out + begin, static_cast<size_t>(end - begin));
+    });
+    return probabilities;
+}
+
+// Class predictions
+Vector QuantizedLogisticRegression::predict(const QuantizedRows& rows) const {
+    Vector predictions = predictProba(rows);
+    for (int i = 0; i < predictions.getSize(); i++) {
+        predictions[i] = (predictions[i] >= 0.5) ? 1.0 : 0.0;  // Threshold at 0.5
+    }
+    return predictions;
+}
+
+Vector QuantizedLogisticRegression::predict(const DataView& data) const {
+    Vector predictions = predictProba(data);
+    for (int i = 0; i < predictions.getSize(); i++) {
+        predictions[i] = (predictions[i] >= 0.5) ? 1.0 : 0.0;
+    }
+    return predictions;
+}
+
+// Getters
+int QuantizedLogisticRegression::getNumFeatures() const {
+    return numFeatures;
+}
+
+double QuantizedLogisticRegression::getWeightStep() const {
+    return weightStep;
+}
+
+double QuantizedLogisticRegression::getBias() const {
+    return bias;
+}
+
+const std::vector<int8_t>& QuantizedLogisticRegression::getWeightCodes() const {
+    return weightCodes;
+}
+
+// Display model information
+void QuantizedLogisticRegression::displayInfo() const {
+    std::cout << "Quantized Logistic Regression (int8)" << std::endl;
+    std::cout << "Features: " << numFeatures << " (" << stride << " bytes per row vs "
+              << numFeatures * static_cast<int>(sizeof(double)) << " as doubles)" << std::endl;
+    std::cout << "Weight step: " << weightStep << std::endl;
+    std::cout << "Folded bias: " << bias << std::endl;
+}
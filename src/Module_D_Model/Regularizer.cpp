@@ -0,0 +1,120 @@
+#include "Regularizer.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+// Default constructor: no penalty
+Regularizer::Regularizer() : type(NONE), strength(0.0), l1Ratio(0.0) {}
+
+// Parameterized constructor
+Regularizer::Regularizer(Type penaltyType, double lambda, double ratio)
+    : type(penaltyType), strength(lambda), l1Ratio(ratio) {
+    if (lambda < 0) {
+        throw std::invalid_argument("Regularization strength must be non-negative");
+    }
+    if (ratio < 0 || ratio > 1) {
+        throw std::invalid_argument("L1 ratio must be in [0, 1]");
+    }
+    if (penaltyType == NONE) {
+        strength = 0.0;
+    } else if (penaltyType == L2) {
+        l1Ratio = 0.0;
+    } else if (penaltyType == L1) {
+        l1Ratio = 1.0;
+    }
+}
+
+// Named factories
+Regularizer Regularizer::none() {
+    return Regularizer();
+}
+
+Regularizer Regularizer::l2(double lambda) {
+    return Regularizer(L2, lambda, 0.0);
+}
+
+Regularizer Regularizer::l1(double lambda) {
+    return Regularizer(L1, lambda, 1.0);
+}
+
+Regularizer Regularizer::elasticNet(double lambda, double ratio) {
+    return Regularizer(ELASTIC_NET, lambda, ratio);
+}
+
+// λ α Σ|w| + λ (1 - α) / 2 Σ w²
+double Regularizer::penalty(const double* w, int n) const {
+    if (!isActive()) {
+        return 0.0;
+    }
+    double absolute = 0.0;
+    double squared = 0.0;
+    for (int j = 0; j < n; j++) {
+        absolute += std::fabs(w[j]);
+        squared += w[j] * w[j];
+    }
+    return getL1() * absolute + 0.5 * getL2() * squared;
+}
+
+double Regularizer::penalty(const Vector& w) const {
+    return penalty(w.rawData(), w.getSize());
+}
+
+// Smooth part: d/dw [λ (1 - α) / 2 w²] = λ (1 - α) w
+void Regularizer::addGradient(const double* w, double* grad, int n) const {
+    double l2 = getL2();
+    if (l2 == 0.0) {
+        return;
+    }
+    for (int j = 0; j < n; j++) {
+        grad[j] += l2 * w[j];
+    }
+}
+
+// Proximal operator of step * λ α |w|: shrink toward zero, clamp at zero
+void Regularizer::proximalStep(double* w, int n, double step) const {
+    double threshold = step * getL1();
+    if (threshold <= 0.0) {
+        return;
+    }
+    for (int j = 0; j < n; j++) {
+        w[j] = std::copysign(std::max(std::fabs(w[j]) - threshold, 0.0), w[j]);
+    }
+}
+
+// Getters
+Regularizer::Type Regularizer::getType() const {
+    return type;
+}
+
+double Regularizer::getStrength() const {
+    return strength;
+}
+
+double Regularizer::getL1Ratio() const {
+    return l1Ratio;
+}
+
+double Regularizer::getL1() const {
+    return strength * l1Ratio;
+}
+
+double Regularizer::getL2() const {
+    return strength * (1.0 - l1Ratio);
+}
+
+bool Regularizer::isActive() const {
+    return type != NONE && strength > 0.0;
+}
+
+bool Regularizer::isSmooth() const {
+    return getL1() == 0.0;
+}
+
+const char* Regularizer::getName() const {
+    switch (type) {
+        case L2: return "L2";
+        case L1: return "L1";
+        case ELASTIC_NET: return "Elastic net";
+        default: return "None";
+    }
+}
@@ -0,0 +1,467 @@
+#include "ScoringServer.h"
+#include "Matrix.h"
+#include "QuantileSketch.h"
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#define TITAN_HAVE_SOCKETS 1
+#endif
+
+namespace {
+// How often blocked loops look at the stop flag
+const int POLL_INTERVAL_MS = 100;
+
+// How often the batcher retries unsent replies, and how long it keeps
+// trying after the last batch before dropping the clients
+const std::chrono::milliseconds FLUSH_INTERVAL(1);
+const std::chrono::milliseconds DRAIN_TIMEOUT(1000);
+
+#ifdef TITAN_HAVE_SOCKETS
+#ifdef MSG_NOSIGNAL
+const int SEND_FLAGS = MSG_DONTWAIT | MSG_NOSIGNAL;  // A vanished client must not raise SIGPIPE
+#else
+const int SEND_FLAGS = MSG_DONTWAIT;
+#endif
+#endif
+
+double microsBetween(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to) {
+    return std::chrono::duration<double, std::micro>(to - from).count();
+}
+}
+
+// One accepted socket; closed when the reader, every queued request and
+// the backlog entry referring to it are gone. outbox and dropped belong to
+// the batcher thread
+struct ScoringServer::Connection {
+    int fd;
+    std::string outbox;  // Reply bytes the socket has not taken yet
+    bool dropped;
+
+    explicit Connection(int socket) : fd(socket), dropped(false) {}
+    ~Connection() {
+#ifdef TITAN_HAVE_SOCKETS
+        ::close(fd);
+#endif
+    }
+
+    // Give up on the client: discard its replies and wake its reader
+    void drop() {
+        dropped = true;
+        outbox.clear();
+        outbox.shrink_to_fit();
+#ifdef TITAN_HAVE_SOCKETS
+        ::shutdown(fd, SHUT_RDWR);
+#endif
+    }
+};
+
+// Constructors
+ScoringServer::ScoringServer(LogisticRegression& model, const ServingOptions& servingOptions)
+    : ScoringServer([&model](const DataView& rows) { return model.predictProba(rows); },
+                    model.getWeights().getSize(), servingOptions) {}
+
+ScoringServer::ScoringServer(const ModelFile& model, const ServingOptions& servingOptions)
+    : ScoringServer([&model](const DataView& rows) { return model.predictProba(rows); },
+                    model.getNumFeatures(), servingOptions) {}
+
+ScoringServer::ScoringServer(Scorer scoreBatch, int features, const ServingOptions& servingOptions)
+    : scorer(std::move(scoreBatch)), numFeatures(features), options(servingOptions),
+      stopping(false), streamOut(nullptr) {
+    if (features < 1) {
+        throw std::invalid_argument("Served model must have at least one feature");
+    }
+    if (servingOptions.maxBatchSize < 1 || servingOptions.maxWaitMicros < 0 ||
+        servingOptions.queueCapacity < 1 || servingOptions.maxLineBytes < 1 ||
+        servingOptions.maxPendingReplyBytes < 1) {
+        throw std::invalid_argument("Batch size, queue capacity and byte limits must be positive, wait non-negative");
+    }
+}
+
+// Parse "x1,x2,...,xd"; malformed lines still get a reply, in order
+ScoringServer::Request ScoringServer::parseRequest(const std::string& line) const {
+    Request request;
+    request.arrival = std::chrono::steady_clock::now();
+    request.features.reserve(numFeatures);
+
+    const char* p = line.c_str();
+    const char* end = p + line.size();
+    while (end > p && (end[-1] == '\r' || end[-1] == ' ')) {
+        end--;
+    }
+    while (p < end) {
+        char* parsedEnd = nullptr;
+        double value = std::strtod(p, &parsedEnd);
+        const char* next = parsedEnd;
+        while (next < end && *next == ' ') {
+            next++;
+        }
+        if (parsedEnd == p || (next < end && *next != ',')) {
+            request.error = "error: could not parse a number in '" + std::string(line.c_str(), end) + "'";
+            return request;
+        }
+        request.features.push_back(value);
+        p = (next < end) ? next + 1 : end;
+    }
+    if (static_cast<int>(request.features.size()) != numFeatures) {
+        request.error = "error: expected " + std::to_string(numFeatures) + " features, got " +
+                        std::to_string(request.features.size());
+    }
+    return request;
+}
+
+// Write one reply line to the stream, or append it to the connection's
+// outbox for the next flushBacklog()
+void ScoringServer::reply(const Request& request, const std::string& line) {
+    if (request.connection == nullptr) {
+        *streamOut << line << '\n';
+        return;
+    }
+    Connection& connection = *request.connection;
+    if (connection.dropped) {
+        return;
+    }
+    if (connection.outbox.empty()) {
+        backlog.push_back(request.connection);
+    }
+    connection.outbox.append(line);
+    connection.outbox.push_back('\n');
+}
+
+// Send what each socket takes without blocking; drop clients that went
+// away or let more than maxPendingReplyBytes pile up unread
+void ScoringServer::flushBacklog() {
+#ifdef TITAN_HAVE_SOCKETS
+    for (size_t i = 0; i < backlog.size();) {
+        Connection& connection = *backlog[i];
+        size_t sent = 0;
+        while (!connection.dropped && sent < connection.outbox.size()) {
+            ssize_t n = ::send(connection.fd, connection.outbox.data() + sent, connection.outbox.size() - sent,
+                               SEND_FLAGS);
+            if (n < 0 && errno == EINTR) {
+                continue;
+            }
+            if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+                break;  // Socket buffer full; retry later
+            }
+            if (n <= 0) {
+                connection.drop();  // Client went away; nothing to report to
+                break;
+            }
+            sent += static_cast<size_t>(n);
+        }
+        if (!connection.dropped) {
+            connection.outbox.erase(0, sent);
+            if (connection.outbox.size() > static_cast<size_t>(options.maxPendingReplyBytes)) {
+                connection.drop();
+            }
+        }
+        if (connection.dropped || connection.outbox.empty()) {
+            backlog[i] = std::move(backlog.back());
+            backlog.pop_back();
+        } else {
+            i++;
+        }
+    }
+#endif
+}
+
+// After the last batch: give slow clients DRAIN_TIMEOUT to take their
+// replies, then drop them
+void ScoringServer::finishBacklog() {
+    auto deadline = std::chrono::steady_clock::now() + DRAIN_TIMEOUT;
+    flushBacklog();
+    while (!backlog.empty() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::sleep_for(FLUSH_INTERVAL);
+        flushBacklog();
+    }
+    for (std::shared_ptr<Connection>& connection : backlog) {
+        connection->drop();
+    }
+    backlog.clear();
+}
+
+// Next request for a batch. While replies wait for a slow client, wake
+// every FLUSH_INTERVAL to retry them. False once the queue is closed and
+// drained
+bool ScoringServer::nextRequest(BoundedQueue<Request>& queue, Request& request) {
+    while (!backlog.empty()) {
+        if (queue.popUntil(request, std::chrono::steady_clock::now() + FLUSH_INTERVAL)) {
+            return true;
+        }
+        flushBacklog();
+        if (queue.isClosed()) {
+            break;  // pop() below no longer blocks
+        }
+    }
+    return queue.pop(request);
+}
+
+// Collect a micro-batch (size or deadline bound), score it, reply, repeat
+ServingStats ScoringServer::runBatcher(BoundedQueue<Request>& queue) {
+    ServingStats stats;
+    QuantileSketch median(0.5);
+    QuantileSketch tail(0.99);
+    std::chrono::steady_clock::time_point firstArrival;
+    std::chrono::steady_clock::time_point lastReply;
+    std::vector<Request> batch;
+    batch.reserve(options.maxBatchSize);
+    char text[32];
+
+    Request first;
+    while (nextRequest(queue, first)) {
+        batch.clear();
+        batch.push_back(std::move(first));
+        auto deadline = batch[0].arrival + std::chrono::microseconds(options.maxWaitMicros);
+        Request next;
+        while (static_cast<int>(batch.size()) < options.maxBatchSize && queue.popUntil(next, deadline)) {
+            batch.push_back(std::move(next));
+        }
+        if (stats.requests == 0) {
+            firstArrival = batch[0].arrival;
+        }
+
+        // One scoring call for every well-formed row of the batch
+        int valid = 0;
+        for (const Request& request : batch) {
+            valid += request.error.empty() ? 1 : 0;
+        }
+        Vector probabilities;
+        if (valid > 0) {
+            Matrix rows(valid, numFeatures);
+            int r = 0;
+            for (const Request& request : batch) {
+                if (request.error.empty()) {
+                    std::copy(request.features.begin(), request.features.end(), rows.rowData(r++));
+                }
+            }
+            probabilities = scorer(DataView(rows));
+        }
+
+        int r = 0;
+        for (const Request& request : batch) {
+            if (request.error.empty()) {
+                std::snprintf(text, sizeof(text), "%.9g", probabilities[r++]);
+                reply(request, text);
+            } else {
+                reply(request, request.error);
+            }
+        }
+        if (streamOut != nullptr) {
+            streamOut->flush();
+        }
+        flushBacklog();
+
+        lastReply = std::chrono::steady_clock::now();
+        for (const Request& request : batch) {
+            double micros = microsBetween(request.arrival, lastReply);
+            median.add(micros);
+            tail.add(micros);
+            stats.maxMicros = std::max(stats.maxMicros, micros);
+        }
+        stats.requests += static_cast<long long>(batch.size());
+        stats.batches++;
+    }
+    finishBacklog();
+
+    if (stats.requests > 0) {
+        stats.seconds = std::chrono::duration<double>(lastReply - firstArrival).count();
+        stats.p50Micros = median.getEstimate();
+        stats.p99Micros = tail.getEstimate();
+        stats.throughput = (stats.seconds > 0) ? stats.requests / stats.seconds : 0.0;
+        stats.meanBatchSize = static_cast<double>(stats.requests) / stats.batches;
+    }
+    return stats;
+}
+
+// Stream mode: a reader thread parses lines while this thread batches and
+// answers. stop() takes effect after the line being read (or end of input)
+ServingStats ScoringServer::serveStream(std::istream& in, std::ostream& out) {
+    stopping = false;
+    streamOut = &out;
+    BoundedQueue<Request> queue(static_cast<size_t>(options.queueCapacity));
+
+    std::thread reader([&]() {
+        std::string line;
+        while (!stopping && std::getline(in, line)) {
+            if (line.empty() || line == "\r") {
+                continue;
+            }
+            Request request;
+            if (line.size() > static_cast<size_t>(options.maxLineBytes)) {
+                request.arrival = std::chrono::steady_clock::now();
+                request.error = "error: line longer than " + std::to_string(options.maxLineBytes) + " bytes";
+            } else {
+                request = parseRequest(line);
+            }
+            if (!queue.push(std::move(request))) {
+                break;
+            }
+        }
+        queue.close();
+    });
+
+    ServingStats stats = runBatcher(queue);
+    reader.join();
+    streamOut = nullptr;
+    return stats;
+}
+
+// Socket mode: an acceptor thread owns the listening socket and starts one
+// reader per connection; this thread batches requests from all of them
+ServingStats ScoringServer::serveSocket(const std::string& path) {
+#ifdef TITAN_HAVE_SOCKETS
+    sockaddr_un address;
+    std::memset(&address, 0, sizeof(address));
+    address.sun_family = AF_UNIX;
+    if (path.empty() || path.size() >= sizeof(address.sun_path)) {
+        throw std::invalid_argument("Socket path is empty or too long: " + path);
+    }
+    std::memcpy(address.sun_path, path.c_str(), path.size());
+
+    int listenFd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenFd < 0) {
+        throw std::runtime_error("Could not create socket: " + std::string(std::strerror(errno)));
+    }
+    ::unlink(path.c_str());
+    if (::bind(listenFd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0 ||
+        ::listen(listenFd, 128) != 0) {
+        std::string reason = std::strerror(errno);
+        ::close(listenFd);
+        throw std::runtime_error("Could not listen on " + path + ": " + reason);
+    }
+
+    stopping = false;
+    BoundedQueue<Request> queue(static_cast<size_t>(options.queueCapacity));
+
+    std::thread acceptor([&]() {
+        struct Reader {
+            std::thread thread;
+            std::shared_ptr<std::atomic<bool>> finished;
+            std::weak_ptr<Connection> connection;
+        };
+        std::vector<Reader> readers;
+
+        while (!stopping) {
+            pollfd waiting;
+            waiting.fd = listenFd;
+            waiting.events = POLLIN;
+            waiting.revents = 0;
+            if (::poll(&waiting, 1, POLL_INTERVAL_MS) > 0) {
+                int fd = ::accept(listenFd, nullptr, nullptr);
+                if (fd >= 0) {
+                    auto connection = std::make_shared<Connection>(fd);
+                    auto finished = std::make_shared<std::atomic<bool>>(false);
+                    Reader reader;
+                    reader.connection = connection;
+                    reader.finished = finished;
+                    reader.thread = std::thread([this, &queue, connection, finished]() {
+                        size_t maxLine = static_cast<size_t>(options.maxLineBytes);
+                        std::string pending;
+                        char buffer[4096];
+                        while (!stopping) {
+                            ssize_t n = ::recv(connection->fd, buffer, sizeof(buffer), 0);
+                            if (n < 0 && errno == EINTR) {
+                                continue;
+                            }
+                            if (n <= 0) {
+                                break;
+                            }
+                            pending.append(buffer, static_cast<size_t>(n));
+                            size_t start = 0;
+                            size_t newline;
+                            while ((newline = pending.find('\n', start)) != std::string::npos) {
+                                if (newline - start > maxLine) {
+                                    break;
+                                }
+                                if (newline > start) {
+                                    Request request = parseRequest(pending.substr(start, newline - start));
+                                    request.connection = connection;
+                                    if (!queue.push(std::move(request))) {
+                                        *finished = true;
+                                        return;
+                                    }
+                                }
+                                start = newline + 1;
+                            }
+                            pending.erase(0, start);
+                            if (pending.size() > maxLine) {
+                                // Over-long line: drop the client rather than buffer without bound
+                                ::shutdown(connection->fd, SHUT_RDWR);
+                                break;
+                            }
+                        }
+                        *finished = true;
+                    });
+                    readers.push_back(std::move(reader));
+                }
+            }
+
+            // Reap readers whose clients have disconnected
+            for (size_t i = 0; i < readers.size();) {
+                if (*readers[i].finished) {
+                    readers[i].thread.join();
+                    readers[i] = std::move(readers.back());
+                    readers.pop_back();
+                } else {
+                    i++;
+                }
+            }
+        }
+
+        // Unblock readers still waiting in recv, then let the batcher drain
+        for (Reader& reader : readers) {
+            if (std::shared_ptr<Connection> connection = reader.connection.lock()) {
+                ::shutdown(connection->fd, SHUT_RD);
+            }
+        }
+        for (Reader& reader : readers) {
+            reader.thread.join();
+        }
+        queue.close();
+    });
+
+    ServingStats stats = runBatcher(queue);
+    acceptor.join();
+    ::close(listenFd);
+    ::unlink(path.c_str());
+    return stats;
+#else
+    (void)path;
+    throw std::runtime_error("Unix domain sockets are not available on this platform");
+#endif
+}
+
+// Only sets an atomic flag, so it is async-signal-safe
+void ScoringServer::stop() {
+    stopping = true;
+}
+
+// Print a stats summary
+void ScoringServer::displayStats(const ServingStats& stats, std::ostream& os) {
+    std::ios::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << "\n========== SERVING STATISTICS ==========" << std::endl;
+    os << std::fixed << std::setprecision(1);
+    os << "Requests:        " << stats.requests << " in " << stats.batches << " batches"
+       << " (mean batch " << stats.meanBatchSize << ")" << std::endl;
+    os << "Latency p50:     " << stats.p50Micros << " us" << std::endl;
+    os << "Latency p99:     " << stats.p99Micros << " us" << std::endl;
+    os << "Latency max:     " << stats.maxMicros << " us" << std::endl;
+    os << std::setprecision(0);
+    os << "Throughput:      " << stats.throughput << " requests/s" << std::endl;
+    os << "========================================\n" << std::endl;
+    os.flags(flags);
+    os.precision(precision);
+}
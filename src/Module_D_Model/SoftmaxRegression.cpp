@@ -0,0 +1,357 @@
+#include "SoftmaxRegression.h"
+#include "Evaluation.h"
+#include "Parallel.h"
+#include "VectorMath.h"
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace {
+// Rows scored at a time inside a block (bounds the score buffer)
+const int ROWS_PER_TILE = 256;
+// Rows sharing each loaded weight row in the GEMM micro-kernel
+const int GEMM_ROWS = 4;
+}
+
+// Default constructor: class count inferred from the labels
+SoftmaxRegression::SoftmaxRegression()
+    : learningRate(0.1), epochs(10), batchSize(256), numClasses(0), shuffleSeed(42),
+      isTrained(false) {}
+
+// Parameterized constructor
+SoftmaxRegression::SoftmaxRegression(int classes, double lr, int numEpochs)
+    : learningRate(lr), epochs(numEpochs), batchSize(256), numClasses(classes), shuffleSeed(42),
+      isTrained(false) {
+    if (classes < 0 || classes == 1) {
+        throw std::invalid_argument("Number of classes must be 0 (infer) or at least 2");
+    }
+}
+
+// Destructor
+SoftmaxRegression::~SoftmaxRegression() {}
+
+// Stable softmax: shifting by the maximum keeps every exp argument <= 0
+void SoftmaxRegression::softmax(double* z, int k) {
+    double maxScore = z[0];
+    for (int c = 1; c < k; c++) {
+        maxScore = std::max(maxScore, z[c]);
+    }
+    for (int c = 0; c < k; c++) {
+        z[c] -= maxScore;
+    }
+    VectorMath::exp(z, z, static_cast<size_t>(k));
+    double sum = 0.0;
+    for (int c = 0; c < k; c++) {
+        sum += z[c];
+    }
+    double inverse = 1.0 / sum;
+    for (int c = 0; c < k; c++) {
+        z[c] *= inverse;
+    }
+}
+
+// Train from a matrix and label vector
+void SoftmaxRegression::train(const Matrix& X, const Vector& y) {
+    if (X.getRows() != y.getSize()) {
+        throw std::invalid_argument("Number of samples must match labels");
+    }
+    train(DataView(X, y));
+}
+
+// Mini-batch SGD: every epoch shuffles the row order with a seed derived
+// from shuffleSeed and the epoch, then updates after each batchSize rows
+void SoftmaxRegression::train(const DataView& data) {
+    if (!data.hasLabels()) {
+        throw std::invalid_argument("Training data must have labels");
+    }
+    int numSamples = data.getRows();
+    int numFeatures = data.getCols();
+    if (numSamples == 0) {
+        throw std::invalid_argument("Cannot train on empty data");
+    }
+    int k = checkLabels(data);
+
+    weights = Matrix(numFeatures, k);
+    bias = Vector(k, 0.0);
+
+    std::cout << "\n========== TRAINING SOFTMAX REGRESSION (MINI-BATCH SGD) ==========" << std::endl;
+    std::cout << "Samples: " << numSamples << ", Features: " << numFeatures
+              << ", Classes: " << k << ", Batch size: " << batchSize << std::endl;
+    std::cout << "Learning Rate: " << learningRate << ", Epochs: " << epochs << std::endl;
+    std::cout << "==================================================================\n" << std::endl;
+
+    // Buffers reused by every batch
+    std::vector<int> order(numSamples);
+    for (int i = 0; i < numSamples; i++) {
+        order[i] = i;
+    }
+    std::vector<double> Z(static_cast<size_t>(batchSize) * k);
+    std::vector<double> gradient(static_cast<size_t>(numFeatures + 1) * k);
+    int reportEvery = std::max(1, epochs / 10);
+
+    for (int epoch = 0; epoch < epochs; epoch++) {
+        DataView::shuffleIndices(order, shuffleSeed + static_cast<unsigned long>(epoch));
+        double epochLoss = 0.0;
+
+        for (int begin = 0; begin < numSamples; begin += batchSize) {
+            int count = std::min(batchSize, numSamples - begin);
+            epochLoss += gradientStep(data, order.data() + begin, count, learningRate, Z, gradient) * count;
+        }
+
+        // Mean loss seen during the epoch (each batch measured before its update)
+        if ((epoch + 1) % reportEvery == 0 || epoch == 0) {
+            std::cout << "Epoch " << std::setw(4) << (epoch + 1)
+                      << " - Loss: " << std::fixed << std::setprecision(4)
+                      << (epochLoss / numSamples) << std::endl;
+        }
+    }
+
+    isTrained = true;
+    std::cout << "\nTraining completed!" << std::endl;
+    std::cout << "==================================================================\n" << std::endl;
+}
+
+// Forward GEMM for one batch, softmax, P - Y, then X^T (P - Y) and the update
+double SoftmaxRegression::gradientStep(const DataView& data, const int* rows, int count, double rate,
+                                       std::vector<double>& Z, std::vector<double>& gradient) {
+    int k = weights.getCols();
+    int numFeatures = weights.getRows();
+    computeScores(data, rows, 0, count, Z.data());
+
+    // Probabilities, loss, and the error P - Y in place
+    double loss = 0.0;
+    for (int r = 0; r < count; r++) {
+        double* p = Z.data() + static_cast<size_t>(r) * k;
+        softmax(p, k);
+        int label = static_cast<int>(data.getLabel(rows[r]));
+        loss -= std::log(std::max(p[label], 1e-15));
+        p[label] -= 1.0;
+    }
+
+    // gradient[j, :] = Σ_r x_rj E[r, :]; the last row collects the bias gradient
+    std::fill(gradient.begin(), gradient.end(), 0.0);
+    double* gb = gradient.data() + static_cast<size_t>(numFeatures) * k;
+    for (int r = 0; r < count; r++) {
+        const double* x = data.row(rows[r]);
+        const double* e = Z.data() + static_cast<size_t>(r) * k;
+        for (int j = 0; j < numFeatures; j++) {
+            double xj = x[j];
+            double* g = gradient.data() + static_cast<size_t>(j) * k;
+            for (int c = 0; c < k; c++) {
+                g[c] += xj * e[c];
+            }
+        }
+        for (int c = 0; c < k; c++) {
+            gb[c] += e[c];
+        }
+    }
+
+    double scale = rate / count;
+    double* w = weights.rawData();
+    size_t weightCount = static_cast<size_t>(numFeatures) * k;
+    for (size_t i = 0; i < weightCount; i++) {
+        w[i] -= scale * gradient[i];
+    }
+    double* b = bias.rawData();
+    for (int c = 0; c < k; c++) {
+        b[c] -= scale * gb[c];
+    }
+    return loss / count;
+}
+
+// Z = X W + 1 b^T for count rows of the view: rows[first + r] when rows is
+// given, else first + r. Each weight row is loaded once per GEMM_ROWS rows
+// and the class loop is contiguous, so it vectorizes.
+void SoftmaxRegression::computeScores(const DataView& data, const int* rows, int first, int count,
+                                      double* Z) const {
+    int k = weights.getCols();
+    int numFeatures = weights.getRows();
+    const double* W = weights.rawData();
+    const double* b = bias.rawData();
+
+    int r = 0;
+    for (; r + GEMM_ROWS <= count; r += GEMM_ROWS) {
+        const double* x[GEMM_ROWS];
+        double* z[GEMM_ROWS];
+        for (int t = 0; t < GEMM_ROWS; t++) {
+            x[t] = data.row(rows != nullptr ? rows[first + r + t] : first + r + t);
+            z[t] = Z + static_cast<size_t>(r + t) * k;
+            std::copy(b, b + k, z[t]);
+        }
+        for (int j = 0; j < numFeatures; j++) {
+            const double* wj = W + static_cast<size_t>(j) * k;
+            double x0 = x[0][j], x1 = x[1][j], x2 = x[2][j], x3 = x[3][j];
+            for (int c = 0; c < k; c++) {
+                double w = wj[c];
+                z[0][c] += x0 * w;
+                z[1][c] += x1 * w;
+                z[2][c] += x2 * w;
+                z[3][c] += x3 * w;
+            }
+        }
+    }
+    for (; r < count; r++) {
+        const double* x = data.row(rows != nullptr ? rows[first + r] : first + r);
+        double* z = Z + static_cast<size_t>(r) * k;
+        std::copy(b, b + k, z);
+        for (int j = 0; j < numFeatures; j++) {
+            const double* wj = W + static_cast<size_t>(j) * k;
+            double xj = x[j];
+            for (int c = 0; c < k; c++) {
+                z[c] += xj * wj[c];
+            }
+        }
+    }
+}
+
+// Labels must be whole numbers in [0, K); returns K
+int SoftmaxRegression::checkLabels(const DataView& data) const {
+    int largest = -1;
+    for (int i = 0; i < data.getRows(); i++) {
+        double label = data.getLabel(i);
+        // Range first: the cast below is undefined for NaN, inf and huge values
+        if (!Evaluation::isClassIndex(label, std::numeric_limits<int>::max())) {
+            throw std::invalid_argument("Labels must be class indices 0, 1, ..., K-1");
+        }
+        largest = std::max(largest, static_cast<int>(label));
+    }
+    if (numClasses > 0) {
+        if (largest >= numClasses) {
+            throw std::invalid_argument("Label exceeds the configured number of classes");
+        }
+        return numClasses;
+    }
+    return std::max(2, largest + 1);
+}
+
+// Make predictions
+Vector SoftmaxRegression::predict(const Matrix& X) {
+    return predict(DataView(X));
+}
+
+// Most probable class per row: argmax of the scores (softmax is monotone)
+Vector SoftmaxRegression::predict(const DataView& data) {
+    if (!isTrained) {
+        throw std::runtime_error("Model must be trained before prediction");
+    }
+    if (data.getCols() != weights.getRows()) {
+        throw std::invalid_argument("Number of features must match trained model");
+    }
+
+    int k = weights.getCols();
+    Vector predictions(data.getRows());
+    Parallel::forRange(0, data.getRows(), Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        std::vector<double> Z(static_cast<size_t>(ROWS_PER_TILE) * k);
+        for (int tile = begin; tile < end; tile += ROWS_PER_TILE) {
+            int count = std::min(ROWS_PER_TILE, end - tile);
+            computeScores(data, nullptr, tile, count, Z.data());
+            for (int r = 0; r < count; r++) {
+                const double* z = Z.data() + static_cast<size_t>(r) * k;
+                predictions[tile + r] = static_cast<double>(std::max_element(z, z + k) - z);
+            }
+        }
+    });
+    return predictions;
+}
+
+// Get probability predictions
+Matrix SoftmaxRegression::predictProba(const Matrix& X) const {
+    return predictProba(DataView(X));
+}
+
+// Scores are written straight into the output rows, then normalized in place
+Matrix SoftmaxRegression::predictProba(const DataView& data) const {
+    if (!isTrained) {
+        throw std::runtime_error("Model must be trained before prediction");
+    }
+    if (data.getCols() != weights.getRows()) {
+        throw std::invalid_argument("Number of features must match trained model");
+    }
+
+    int k = weights.getCols();
+    Matrix probabilities(data.getRows(), k);
+    Parallel::forRange(0, data.getRows(), Parallel::ROWS_PER_BLOCK, [&](int, int begin, int end) {
+        if (begin == end) {
+            return;
+        }
+        computeScores(data, nullptr, begin, end - begin, probabilities.rowData(begin));
+        for (int i = begin; i < end; i++) {
+            softmax(probabilities.rowData(i), k);
+        }
+    });
+    return probabilities;
+}
+
+// Mean cross-entropy -1/m Σ log p_(y_i) with the current parameters
+double SoftmaxRegression::meanLoss(const DataView& data) const {
+    if (!data.hasLabels()) {
+        throw std::invalid_argument("Loss requires labelled data");
+    }
+    Matrix probabilities = predictProba(data);
+    double loss = 0.0;
+    for (int i = 0; i < data.getRows(); i++) {
+        double label = data.getLabel(i);
+        if (!Evaluation::isClassIndex(label, weights.getCols())) {
+            throw std::invalid_argument("Label outside the model's classes");
+        }
+        loss -= std::log(std::max(probabilities.rowData(i)[static_cast<int>(label)], 1e-15));
+    }
+    return loss / std::max(1, data.getRows());
+}
+
+// Display model information
+void SoftmaxRegression::displayInfo() const {
+    std::cout << "Softmax Regression Model" << std::endl;
+    std::cout << "Learning Rate: " << learningRate << std::endl;
+    std::cout << "Epochs: " << epochs << std::endl;
+    std::cout << "Batch size: " << batchSize << std::endl;
+    std::cout << "Trained: " << (isTrained ? "Yes" : "No") << std::endl;
+    if (isTrained) {
+        std::cout << "Number of features: " << weights.getRows() << std::endl;
+        std::cout << "Number of classes: " << weights.getCols() << std::endl;
+    }
+}
+
+// Getters
+Matrix SoftmaxRegression::getWeights() const {
+    return weights;
+}
+
+Vector SoftmaxRegression::getBias() const {
+    return bias;
+}
+
+int SoftmaxRegression::getNumClasses() const {
+    return isTrained ? weights.getCols() : numClasses;
+}
+
+int SoftmaxRegression::getBatchSize() const {
+    return batchSize;
+}
+
+bool SoftmaxRegression::getIsTrained() const {
+    return isTrained;
+}
+
+// Setters
+void SoftmaxRegression::setLearningRate(double lr) {
+    learningRate = lr;
+}
+
+void SoftmaxRegression::setEpochs(int numEpochs) {
+    epochs = numEpochs;
+}
+
+void SoftmaxRegression::setBatchSize(int rows) {
+    if (rows < 1) {
+        throw std::invalid_argument("Batch size must be positive");
+    }
+    batchSize = rows;
+}
+
+void SoftmaxRegression::setShuffleSeed(unsigned long seed) {
+    shuffleSeed = seed;
+}
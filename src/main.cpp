@@ -1,5 +1,9 @@
+#include <chrono>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <vector>
 
 using namespace std;
 
@@ -16,6 +20,7 @@ using namespace std;
 
 // Module C: Data Management
 #include "Dataset.h"
+#include "DataView.h"
 #include "Scaler.h"
 #include "MinMaxScaler.h"
 
@@ -23,9 +28,88 @@ using namespace std;
 #include "Model.h"
 #include "LogisticRegression.h"
 #include "Evaluation.h"
+#include "Pipeline.h"
+#include "LBFGSOptimizer.h"
+#include "ModelFile.h"
+#include "QuantizedLogisticRegression.h"
+#include "HyperparameterSearch.h"
+#include "ScoringServer.h"
 
-int main()
+#include <csignal>
+#include <cstdlib>
+#include <string>
+
+// Server stopped by Ctrl-C / SIGTERM in serving mode
+static ScoringServer *activeServer = nullptr;
+
+static void stopServer(int)
+{
+    if (activeServer != nullptr)
+    {
+        activeServer->stop();
+    }
+}
+
+// Serving mode: TitanLearn --serve <model.tlmodel> [--socket <path>] [--batch <rows>] [--wait-us <micros>]
+// Replies go to stdout (stdin mode) or the socket; everything else goes to stderr
+static int serve(int argc, char *argv[])
+{
+    string modelPath = argv[2];
+    string socketPath;
+    ServingOptions options;
+    for (int i = 3; i + 1 < argc; i += 2)
+    {
+        string flag = argv[i];
+        if (flag == "--socket")
+            socketPath = argv[i + 1];
+        else if (flag == "--batch")
+            options.maxBatchSize = atoi(argv[i + 1]);
+        else if (flag == "--wait-us")
+            options.maxWaitMicros = atoi(argv[i + 1]);
+        else
+        {
+            cerr << "Unknown option " << flag << endl;
+            return 1;
+        }
+    }
+
+    ModelFile model;
+    if (!model.open(modelPath))
+    {
+        cerr << "Could not open model file " << modelPath << " (run TitanLearn once to create one)" << endl;
+        return 1;
+    }
+
+    try
+    {
+        ScoringServer server(model, options);
+        activeServer = &server;
+        signal(SIGINT, stopServer);
+        signal(SIGTERM, stopServer);
+
+        cerr << "Serving " << modelPath << " (" << model.getNumFeatures() << " features) on "
+             << (socketPath.empty() ? string("stdin") : socketPath) << ", batch <= " << options.maxBatchSize
+             << ", wait <= " << options.maxWaitMicros << " us" << endl;
+        ServingStats stats = socketPath.empty() ? server.serveStream(cin, cout) : server.serveSocket(socketPath);
+        activeServer = nullptr;
+        ScoringServer::displayStats(stats, cerr);
+    }
+    catch (const exception &e)
+    {
+        activeServer = nullptr;
+        cerr << "\nError: " << e.what() << endl;
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char *argv[])
 {
+    if (argc >= 3 && string(argv[1]) == "--serve")
+    {
+        return serve(argc, argv);
+    }
+
     cout << "\n";
     cout << "======================================================" << endl;
     cout << "    TITAN-LEARN: C++ LOGISTIC REGRESSION ENGINE      " << endl;
@@ -59,63 +143,112 @@ int main()
         cout << "----------------------------------------------------" << endl;
 
         DataSummary summary;
-        Matrix features = dataset.getFeatures();
+        const Matrix &features = dataset.getFeatures();
         summary.generateReport(features);
 
-        // ==================== STEP 3: Feature Scaling ====================
-        cout << "\nSTEP 3: Scaling Features..." << endl;
+        // ==================== STEP 3: Split Data ====================
+        cout << "\nSTEP 3: Splitting Data into Train/Test Sets..." << endl;
+        cout << "----------------------------------------------------" << endl;
+
+        // Stratified 80/20 split; both views index into the loaded matrix
+        DataSplit split = dataset.trainTestSplit(0.2, 42);
+
+        cout << "Training samples: " << split.train.getRows() << endl;
+        cout << "Test samples:     " << split.test.getRows() << endl;
+        cout << "Features: " << split.train.getCols() << endl;
+        cout << endl;
+
+        // ==================== STEP 4: Build Pipeline ====================
+        cout << "\nSTEP 4: Building Scaler + Model Pipeline..." << endl;
         cout << "----------------------------------------------------" << endl;
 
+        // Stages stay owned here; the pipeline streams row blocks through them
         MinMaxScaler scaler;
-        scaler.fit(features);
-        Matrix scaledFeatures = scaler.transform(features);
+        LogisticRegression model(0.1, 500); // learning rate = 0.1, epochs = 500
+        model.setOptimizer(make_shared<LBFGSOptimizer>());  // Tens of passes instead of 500 epochs
+        Pipeline pipeline;
+        pipeline.addScaler(scaler).setModel(model);
+        pipeline.displayInfo();
+
+        // ==================== STEP 5: Train Model ====================
+        cout << "\nSTEP 5: Scaling Features and Training Logistic Regression Model..." << endl;
+        cout << "----------------------------------------------------" << endl;
+
+        // Fit on training rows only so no test information leaks into scaling
+        pipeline.fit(split.train);
 
         cout << "Features scaled to range [0, 1]" << endl;
         cout << "First 3 rows of scaled data:" << endl;
-        for (int i = 0; i < min(3, scaledFeatures.getRows()); i++)
+        vector<int> headRows;
+        for (int i = 0; i < min(3, features.getRows()); i++)
+        {
+            headRows.push_back(i);
+        }
+        Matrix scaledHead = pipeline.transform(DataView(features, dataset.getLabels(), headRows));
+        for (int i = 0; i < scaledHead.getRows(); i++)
         {
             cout << "Row " << i << ": ";
-            for (int j = 0; j < scaledFeatures.getCols(); j++)
+            for (int j = 0; j < scaledHead.getCols(); j++)
             {
                 cout << fixed << setprecision(4)
-                     << scaledFeatures.getValue(i, j) << " ";
+                     << scaledHead.getValue(i, j) << " ";
             }
             cout << endl;
         }
         cout << endl;
 
-        // ==================== STEP 4: Split Data (Simple Approach) ====================
-        cout << "\nSTEP 4: Preparing Training Data..." << endl;
-        cout << "----------------------------------------------------" << endl;
-
-        // For this demo, we'll use the entire dataset for training
-        // In practice, you would split into train/test sets
-        Matrix X_train = scaledFeatures;
-        Vector y_train = dataset.getLabels();
-
-        cout << "Training samples: " << X_train.getRows() << endl;
-        cout << "Features: " << X_train.getCols() << endl;
-        cout << endl;
-
-        // ==================== STEP 5: Train Model ====================
-        cout << "\nSTEP 5: Training Logistic Regression Model..." << endl;
-        cout << "----------------------------------------------------" << endl;
-
-        LogisticRegression model(0.1, 500); // learning rate = 0.1, epochs = 500
-        model.train(X_train, y_train);
-
         // ==================== STEP 6: Make Predictions ====================
-        cout << "\nSTEP 6: Making Predictions..." << endl;
+        cout << "\nSTEP 6: Making Predictions on Test Set..." << endl;
         cout << "----------------------------------------------------" << endl;
 
-        Vector predictions = model.predict(X_train);
+        // Scaling and scoring happen block by block on the raw test rows
+        const DataView &testView = split.test;
+        Vector predictions = pipeline.predict(testView);
+        Vector y_test = testView.gatherLabels();
 
         cout << "Predictions completed!" << endl;
         cout << "First 10 predictions vs actual:" << endl;
         for (int i = 0; i < min(10, predictions.getSize()); i++)
         {
-            cout << "Sample " << i << ": Predicted = " << predictions[i]
-                 << ", Actual = " << y_train[i] << endl;
+            cout << "Sample " << testView.rowIndex(i) << ": Predicted = " << predictions[i]
+                 << ", Actual = " << y_test[i] << endl;
+        }
+        cout << endl;
+
+        // Fold the scaler into the weights: the exported model scores raw
+        // rows directly, so serving skips the transform pass entirely
+        LogisticRegression servingModel = model.foldScaler(scaler);
+        Matrix scaledTest = pipeline.transform(testView);
+        Vector scaledProba = model.predictProba(scaledTest);
+        Vector rawProba = servingModel.predictProba(testView);
+        double maxDiff = 0.0;
+        for (int i = 0; i < rawProba.getSize(); i++)
+        {
+            maxDiff = max(maxDiff, fabs(rawProba[i] - scaledProba[i]));
+        }
+        cout << "Scaler folded into model weights; max probability difference on raw features: "
+             << scientific << maxDiff << fixed << endl;
+
+        // Save the folded model and serve it straight from the mapped file,
+        // as a separate scoring process would at startup
+        if (ModelFile::save("titanlearn_model.tlmodel", model, &scaler))
+        {
+            auto loadStart = chrono::steady_clock::now();
+            ModelFile savedModel;
+            bool opened = savedModel.open("titanlearn_model.tlmodel");
+            double loadMs = chrono::duration<double, milli>(chrono::steady_clock::now() - loadStart).count();
+            if (opened)
+            {
+                Vector mappedProba = savedModel.predictProba(testView);
+                double mappedDiff = 0.0;
+                for (int i = 0; i < mappedProba.getSize(); i++)
+                {
+                    mappedDiff = max(mappedDiff, fabs(mappedProba[i] - rawProba[i]));
+                }
+                cout << "Model saved to titanlearn_model.tlmodel and mapped in " << setprecision(3)
+                     << loadMs << " ms; max probability difference: " << scientific << mappedDiff
+                     << fixed << endl;
+            }
         }
         cout << endl;
 
@@ -123,10 +256,10 @@ int main()
         cout << "\nSTEP 7: Evaluating Model Performance..." << endl;
         cout << "----------------------------------------------------" << endl;
 
-        double accuracy = Evaluation::calculateAccuracy(predictions, y_train);
-        double precision = Evaluation::calculatePrecision(predictions, y_train);
-        double recall = Evaluation::calculateRecall(predictions, y_train);
-        double f1Score = Evaluation::calculateF1Score(predictions, y_train);
+        double accuracy = Evaluation::calculateAccuracy(predictions, y_test);
+        double precision = Evaluation::calculatePrecision(predictions, y_test);
+        double recall = Evaluation::calculateRecall(predictions, y_test);
+        double f1Score = Evaluation::calculateF1Score(predictions, y_test);
 
         cout << "\n========== MODEL PERFORMANCE METRICS ==========" << endl;
         cout << fixed << setprecision(4);
@@ -136,7 +269,14 @@ int main()
         cout << "F1 Score:  " << (f1Score * 100) << "%" << endl;
         cout << "===============================================" << endl;
 
-        Evaluation::displayConfusionMatrix(predictions, y_train);
+        Evaluation::displayConfusionMatrix(predictions, y_test);
+
+        // int8 copy of the serving model, calibrated on the training rows
+        QuantizedLogisticRegression quantizedModel(servingModel, split.train);
+        Vector quantizedPredictions = quantizedModel.predict(testView);
+        double quantizedAccuracy = Evaluation::calculateAccuracy(quantizedPredictions, y_test);
+        cout << "int8 quantized model accuracy: " << (quantizedAccuracy * 100) << "% (delta "
+             << ((quantizedAccuracy - accuracy) * 100) << " points)" << endl;
 
         // ==================== STEP 8: Analyze Model ====================
         cout << "\nSTEP 8: Model Analysis (Using Friend Function)..." << endl;
@@ -144,6 +284,25 @@ int main()
 
         Evaluation::analyzeModel(model);
 
+        // ==================== STEP 9: Hyperparameter Search ====================
+        cout << "\nSTEP 9: Searching Learning Rate and Epochs (Successive Halving)..." << endl;
+        cout << "----------------------------------------------------" << endl;
+
+        // Every trial reads one scaled copy of the features. The training rows
+        // are split again so the test rows stay out of model selection
+        Matrix scaledFeatures = pipeline.transform(DataView(features, dataset.getLabels()));
+        vector<int> searchRows = split.train.getIndices();
+        DataView::shuffleIndices(searchRows, 7);
+        size_t searchCut = searchRows.size() * 3 / 4;
+        DataView searchTrain(scaledFeatures, dataset.getLabels(),
+                             vector<int>(searchRows.begin(), searchRows.begin() + searchCut));
+        DataView searchValidation(scaledFeatures, dataset.getLabels(),
+                                  vector<int>(searchRows.begin() + searchCut, searchRows.end()));
+        HyperparameterSearch search;
+        SearchResult searchResult = search.run(HyperparameterSearch::grid({0.01, 0.1, 0.5, 1.0}, {100, 300, 500}),
+                                               searchTrain, searchValidation);
+        HyperparameterSearch::displayResults(searchResult);
+
         // ==================== DEMONSTRATION OF OOP CONCEPTS ====================
         cout << "\n======================================================" << endl;
         cout << "    OOP CONCEPTS DEMONSTRATED IN THIS PROJECT        " << endl;
@@ -0,0 +1,441 @@
+// Behaviour checks for the model code, run by CTest.
+// Usage: BehaviourChecks <check>   (optimizers, folding, quantization,
+//                                   modelfile, partialfit, warmstart)
+//
+// Each check builds a small synthetic problem, exercises one feature and
+// compares the result with what the feature promises: solvers reach a
+// zero gradient, a folded scaler scores and learns like the pipeline,
+// quantized scores stay within the analytic rounding bound, a saved model
+// round-trips and corrupt files are refused, partialFit learns, and a
+// continued run ends where a longer fresh run would. A
+// failed expectation prints its description and exits non-zero.
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataView.h"
+#include "LBFGSOptimizer.h"
+#include "LogisticObjective.h"
+#include "LogisticRegression.h"
+#include "MappedFile.h"
+#include "Matrix.h"
+#include "ModelFile.h"
+#include "NewtonOptimizer.h"
+#include "QuantizedLogisticRegression.h"
+#include "StandardScaler.h"
+#include "Vector.h"
+
+namespace {
+
+// Throw with the description unless the condition holds
+void expect(bool condition, const std::string& what) {
+    if (!condition) {
+        throw std::runtime_error(what);
+    }
+}
+
+// Features with mixed scales and offsets; labels from a noisy linear model
+void makeData(int rows, int features, unsigned long seed, Matrix& X, Vector& y) {
+    std::mt19937_64 rng(seed);
+    std::normal_distribution<double> normal(0.0, 1.0);
+    std::uniform_real_distribution<double> uniform(0.0, 1.0);
+    X = Matrix(rows, features);
+    y = Vector(rows);
+    for (int i = 0; i < rows; i++) {
+        double* x = X.rowData(i);
+        double z = 0.2;
+        for (int j = 0; j < features; j++) {
+            double standard = normal(rng);
+            x[j] = 10.0 * j + (j + 1) * standard;
+            z += standard * ((j % 2 == 0) ? 0.9 : -0.6);
+        }
+        y[i] = (uniform(rng) < 1.0 / (1.0 + std::exp(-z))) ? 1.0 : 0.0;
+    }
+}
+
+double maxAbsDifference(const Vector& a, const Vector& b) {
+    double largest = 0.0;
+    for (int i = 0; i < a.getSize(); i++) {
+        largest = std::max(largest, std::fabs(a[i] - b[i]));
+    }
+    return largest;
+}
+
+double meanLogLoss(const Vector& p, const Vector& y) {
+    double loss = 0.0;
+    for (int i = 0; i < y.getSize(); i++) {
+        double q = std::min(1 - 1e-7, std::max(1e-7, p[i]));
+        loss -= y[i] * std::log(q) + (1 - y[i]) * std::log(1 - q);
+    }
+    return loss / y.getSize();
+}
+
+// Largest gradient component of the (L2-penalized) objective at the model
+double gradientNorm(const LogisticRegression& model, const DataView& data, double l2) {
+    Vector w = model.getWeights();
+    Vector theta(w.getSize() + 1);
+    for (int j = 0; j < w.getSize(); j++) {
+        theta[j] = w[j];
+    }
+    theta[w.getSize()] = model.getBias();
+    LogisticObjective objective(data, l2);
+    Vector gradient;
+    objective.evaluate(theta, gradient);
+    return maxAbsDifference(gradient, Vector(gradient.getSize(), 0.0));
+}
+
+// L-BFGS and Newton stop at the same stationary point of a strictly convex
+// objective, well inside their iteration limits
+void checkOptimizers() {
+    Matrix X;
+    Vector y;
+    makeData(4000, 6, 1, X, y);
+    StandardScaler scaler;
+    scaler.fit(X);
+    Matrix scaled = scaler.transform(X);
+    DataView data(scaled, y);
+    double l2 = 1e-3;
+
+    LogisticRegression lbfgs(0.1, 100);
+    lbfgs.setVerbose(false);
+    lbfgs.setRegularizer(Regularizer::l2(l2));
+    lbfgs.setOptimizer(std::make_shared<LBFGSOptimizer>(200, 1e-8));
+    lbfgs.train(data);
+
+    LogisticRegression newton(0.1, 100);
+    newton.setVerbose(false);
+    newton.setRegularizer(Regularizer::l2(l2));
+    newton.setOptimizer(std::make_shared<NewtonOptimizer>(50, 1e-10));
+    newton.train(data);
+
+    expect(gradientNorm(lbfgs, data, l2) < 1e-7, "L-BFGS reaches a zero gradient");
+    expect(gradientNorm(newton, data, l2) < 1e-9, "Newton reaches a zero gradient");
+    expect(lbfgs.getEpochsRun() < 200, "L-BFGS converges before its iteration limit");
+    expect(newton.getEpochsRun() < 20, "Newton converges in a handful of iterations");
+    expect(maxAbsDifference(lbfgs.getWeights(), newton.getWeights()) < 1e-5, "Both solvers find the same weights");
+    expect(std::fabs(lbfgs.getBias() - newton.getBias()) < 1e-5, "Both solvers find the same bias");
+}
+
+// A model folded with its scaler scores raw rows like model + scaler, and
+// keeps learning like it
+void checkFolding() {
+    Matrix X;
+    Vector y;
+    makeData(2000, 5, 2, X, y);
+    StandardScaler scaler;
+    scaler.fit(X);
+    Matrix scaled = scaler.transform(X);
+
+    LogisticRegression model(0.5, 200);
+    model.setVerbose(false);
+    model.train(DataView(scaled, y));
+    LogisticRegression folded = model.foldScaler(scaler);
+
+    Vector expected = model.predictProba(DataView(scaled));
+    Vector actual = folded.predictProba(DataView(X));
+    expect(maxAbsDifference(expected, actual) < 1e-12, "Folded model matches the scaled pipeline");
+
+    // partialFit on raw rows continues like partialFit on the pipeline,
+    // AdaGrad sums included: learn online first, fold, then update both
+    std::vector<int> first;
+    std::vector<int> rest;
+    for (int i = 0; i < X.getRows(); i++) {
+        (i < 1000 ? first : rest).push_back(i);
+    }
+    LogisticRegression online(0.5, 1);
+    online.setVerbose(false);
+    online.partialFit(DataView(scaled, y, first));
+    LogisticRegression onlineFolded = online.foldScaler(scaler);
+    online.partialFit(DataView(scaled, y, rest));
+    onlineFolded.partialFit(DataView(X, y, rest));
+    expect(maxAbsDifference(online.predictProba(DataView(scaled)), onlineFolded.predictProba(DataView(X))) < 1e-9,
+           "partialFit on the folded model matches partialFit on the pipeline");
+}
+
+// Every quantized probability stays within the rounding bound: with input
+// step s_j = (hi_j - lo_j) / 254 and code error at most half a step,
+//   |dz| <= sum_j |w_j| s_j / 2 + weightStep / 2 * sum_j |q_j|
+// and |dp| <= |dz| / 4
+void checkQuantization() {
+    Matrix X;
+    Vector y;
+    makeData(3000, 8, 3, X, y);
+    LogisticRegression model(0.001, 300);
+    model.setVerbose(false);
+    model.train(DataView(X, y));
+    DataView data(X, y);
+    QuantizedLogisticRegression quantized(model, data);
+
+    Vector w = model.getWeights();
+    int d = X.getCols();
+    double inputTerm = 0.0;
+    for (int j = 0; j < d; j++) {
+        double lo = X.rowData(0)[j];
+        double hi = lo;
+        for (int i = 1; i < X.getRows(); i++) {
+            lo = std::min(lo, X.rowData(i)[j]);
+            hi = std::max(hi, X.rowData(i)[j]);
+        }
+        inputTerm += std::fabs(w[j]) * (hi - lo) / 254.0 / 2.0;
+    }
+
+    QuantizedRows rows = quantized.quantize(data);
+    Vector exact = model.predictProba(data);
+    Vector approximate = quantized.predictProba(rows);
+    for (int i = 0; i < X.getRows(); i++) {
+        long long codeSum = 0;
+        for (int j = 0; j < d; j++) {
+            codeSum += std::abs(static_cast<int>(rows.row(i)[j]));
+        }
+        double bound = (inputTerm + quantized.getWeightStep() / 2.0 * codeSum) / 4.0;
+        expect(std::fabs(exact[i] - approximate[i]) <= bound + 1e-12,
+               "Quantized probability of row " + std::to_string(i) + " is within the rounding bound");
+    }
+}
+
+// Read or write a whole file
+std::vector<char> readBytes(const std::string& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+}
+
+void writeBytes(const std::string& path, const std::vector<char>& bytes, size_t count) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), static_cast<std::streamsize>(count));
+}
+
+// Overwrite a field of a saved model and recompute the checksum, as a
+// foreign writer would; offsets follow the layout in ModelFile.h
+template <typename T>
+std::vector<char> withField(const std::vector<char>& bytes, size_t offset, T value) {
+    const size_t headerBytes = 64;
+    const size_t checksumOffset = 24;
+    std::vector<char> edited = bytes;
+    std::memcpy(edited.data() + offset, &value, sizeof(value));
+    uint64_t checksum = MappedFile::checksum(edited.data() + headerBytes, edited.size() - headerBytes);
+    std::memcpy(edited.data() + checksumOffset, &checksum, sizeof(checksum));
+    return edited;
+}
+
+// save/load/open round-trip exactly (folded models included, so partialFit
+// continues in the scaled space); corrupt, truncated and missing files and
+// well-formed files with out-of-range fields are refused with false
+void checkModelFile() {
+    Matrix X;
+    Vector y;
+    makeData(1000, 4, 4, X, y);
+    LogisticRegression model(0.01, 50);
+    model.setVerbose(false);
+    model.setRegularizer(Regularizer::elasticNet(0.01, 0.3));
+    model.train(DataView(X, y));
+
+    const std::string path = "BehaviourChecks.tlmodel";
+    expect(ModelFile::save(path, model), "Trained model saves");
+
+    LogisticRegression loaded;
+    expect(ModelFile::load(path, loaded), "Saved model loads");
+    expect(maxAbsDifference(model.getWeights(), loaded.getWeights()) == 0.0, "Weights round-trip exactly");
+    expect(model.getBias() == loaded.getBias(), "Bias round-trips exactly");
+    expect(loaded.getRegularizer().getType() == Regularizer::ELASTIC_NET &&
+           loaded.getRegularizer().getL1Ratio() == 0.3, "Regularizer round-trips");
+
+    ModelFile mapped;
+    expect(mapped.open(path), "Saved model maps");
+    expect(maxAbsDifference(model.predictProba(DataView(X)), mapped.predictProba(DataView(X))) == 0.0,
+           "Mapped model scores like the trained one");
+    mapped.close();
+
+    std::vector<char> bytes = readBytes(path);
+    std::vector<char> corrupt = bytes;
+    corrupt[128] ^= 0x10;  // First weight
+    writeBytes(path, corrupt, corrupt.size());
+    expect(!ModelFile::load(path, loaded), "A flipped weight bit is refused");
+
+    writeBytes(path, bytes, bytes.size() - 8);
+    expect(!mapped.open(path), "A truncated file is refused");
+
+    const std::vector<std::pair<std::vector<char>, std::string>> invalid = {
+        {withField<uint32_t>(bytes, 12, 0x80), "Unknown flag bits are refused"},
+        {withField<int32_t>(bytes, 64 + 48, 7), "An unknown schedule is refused"},
+        {withField<int32_t>(bytes, 64 + 52, -1), "An unknown regularizer type is refused"},
+        {withField<double>(bytes, 64 + 16, -1.0), "A negative regularization strength is refused"},
+        {withField<double>(bytes, 64 + 24, 1.5), "An L1 ratio above one is refused"},
+        {withField<int32_t>(bytes, 64 + 40, -3), "A negative epoch count is refused"},
+    };
+    for (const auto& file : invalid) {
+        writeBytes(path, file.first, file.first.size());
+        expect(!ModelFile::load(path, loaded), file.second);  // false, not an exception
+    }
+    writeBytes(path, withField<double>(bytes, 64 + 24, 0.5), bytes.size());
+    expect(ModelFile::load(path, loaded), "A consistent edit with a fresh checksum still loads");
+
+    // A folded model keeps learning in the scaled space after a round-trip:
+    // saved with its scaler, or folded first and saved without one
+    StandardScaler scaler;
+    scaler.fit(X);
+    Matrix scaled = scaler.transform(X);
+    std::vector<int> first;
+    std::vector<int> rest;
+    for (int i = 0; i < X.getRows(); i++) {
+        (i < 600 ? first : rest).push_back(i);
+    }
+    LogisticRegression pipeline(0.5, 50);
+    pipeline.setVerbose(false);
+    pipeline.train(DataView(scaled, y, first));
+    LogisticRegression inMemory = pipeline.foldScaler(scaler);
+    expect(ModelFile::save(path, pipeline, &scaler), "Model saves with its scaler");
+    LogisticRegression reloaded;
+    expect(ModelFile::load(path, reloaded), "Folded model loads");
+    expect(ModelFile::save(path, inMemory), "Folded model saves without a scaler");
+    LogisticRegression refolded;
+    expect(ModelFile::load(path, refolded), "Folded model saved without a scaler loads");
+    reloaded.setVerbose(false);
+    refolded.setVerbose(false);
+    inMemory.partialFit(DataView(X, y, rest));
+    reloaded.partialFit(DataView(X, y, rest));
+    refolded.partialFit(DataView(X, y, rest));
+    Vector expected = inMemory.predictProba(DataView(X));
+    expect(maxAbsDifference(expected, reloaded.predictProba(DataView(X))) < 1e-12,
+           "partialFit after save/load matches partialFit in memory");
+    expect(maxAbsDifference(expected, refolded.predictProba(DataView(X))) < 1e-12,
+           "A folded model saved without a scaler keeps its fold");
+
+    std::remove(path.c_str());
+    expect(!ModelFile::load(path, loaded), "A missing file is refused");
+}
+
+// partialFit counts its rows, lowers the loss on data it has not seen, and
+// continues from train() weights rather than starting over
+void checkPartialFit() {
+    Matrix X;
+    Vector y;
+    makeData(6000, 5, 5, X, y);
+    StandardScaler scaler;
+    scaler.fit(X);
+    Matrix scaled = scaler.transform(X);
+
+    std::vector<int> first;
+    std::vector<int> rest;
+    std::vector<int> heldOut;
+    for (int i = 0; i < X.getRows(); i++) {
+        (i < 2000 ? first : (i < 5000 ? rest : heldOut)).push_back(i);
+    }
+    DataView test(scaled, y, heldOut);
+
+    LogisticRegression online(0.1, 1);
+    online.setVerbose(false);
+    double start = std::log(2.0);  // Zero weights: p = 0.5 for every row
+    online.partialFit(DataView(scaled, y, first));
+    double afterOne = meanLogLoss(online.predictProba(test), test.gatherLabels());
+    online.partialFit(DataView(scaled, y, rest));
+    double afterTwo = meanLogLoss(online.predictProba(test), test.gatherLabels());
+
+    expect(online.getPartialFitRows() == 5000, "partialFit counts every absorbed row");
+    expect(afterOne < start, "The first partialFit lowers the held-out loss");
+    expect(afterTwo <= afterOne + 1e-3, "More data does not undo the first update");
+
+    LogisticRegression trained(0.5, 100);
+    trained.setVerbose(false);
+    trained.train(DataView(scaled, y, first));
+    double trainedLoss = meanLogLoss(trained.predictProba(test), test.gatherLabels());
+    trained.partialFit(DataView(scaled, y, rest));
+    expect(trained.getPartialFitRows() == 3000, "train() resets the partialFit row count");
+    double updatedLoss = meanLogLoss(trained.predictProba(test), test.gatherLabels());
+    expect(updatedLoss < trainedLoss + 0.01, "partialFit continues from the trained weights");
+}
+
+
+// continueTraining after raising the epoch count matches one longer run, in
+// the full-batch and mini-batch modes
+void checkWarmStart() {
+    Matrix X;
+    Vector y;
+    makeData(3000, 6, 6, X, y);
+    StandardScaler scaler;
+    scaler.fit(X);
+    Matrix scaled = scaler.transform(X);
+    DataView data(scaled, y);
+
+    for (int batch : {0, 64}) {
+        std::string mode = (batch == 0) ? "full-batch" : "mini-batch";
+        LogisticRegression fresh(0.3, 30);
+        fresh.setBatchSize(batch);
+        fresh.setVerbose(false);
+        fresh.train(data);
+
+        LogisticRegression continued(0.3, 10);
+        continued.setBatchSize(batch);
+        continued.setVerbose(false);
+        continued.train(data);
+        continued.setEpochs(30);
+        continued.continueTraining(data);
+
+        expect(continued.getEpochsRun() == 30, mode + " continued run counts every epoch");
+        expect(maxAbsDifference(fresh.getWeights(), continued.getWeights()) < 1e-12 &&
+               std::fabs(fresh.getBias() - continued.getBias()) < 1e-12,
+               mode + " continued run matches one longer run");
+    }
+
+    LogisticRegression untrained;
+    bool refused = false;
+    try {
+        untrained.continueTraining(data);
+    } catch (const std::runtime_error&) {
+        refused = true;
+    }
+    expect(refused, "continueTraining refuses an untrained model");
+}
+
+}
+
+int main(int argc, char* argv[]) {
+    std::map<std::string, std::function<void()>> checks = {
+        {"optimizers", checkOptimizers},
+        {"folding", checkFolding},
+        {"quantization", checkQuantization},
+        {"modelfile", checkModelFile},
+        {"partialfit", checkPartialFit},
+        {"warmstart", checkWarmStart},
+    };
+
+    std::vector<std::string> selected;
+    if (argc > 1) {
+        selected.push_back(argv[1]);
+    } else {
+        for (const auto& check : checks) {
+            selected.push_back(check.first);
+        }
+    }
+
+    int failures = 0;
+    for (const std::string& name : selected) {
+        auto check = checks.find(name);
+        if (check == checks.end()) {
+            std::cerr << "Unknown check: " << name << std::endl;
+            return 2;
+        }
+        try {
+            check->second();
+            std::cout << "PASS " << name << std::endl;
+        } catch (const std::exception& e) {
+            std::cout << "FAIL " << name << ": " << e.what() << std::endl;
+            failures++;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}